@@ -679,7 +679,7 @@ bool butchery_drops_harvest( butchery_data bt, Character &you )
         for( item *item : corpse_item.all_items_top( pocket_type::CORPSE ) ) {
             dissectable_num++;
             const int skill_level = butchery_dissect_skill_level( you, tool_quality,
-                                    item->dropped_from );
+                                    item->get_dropped_from() );
             const int butchery = roll_butchery_dissect( skill_level, you.dex_cur, tool_quality );
             dissectable_practice += ( 4 + butchery );
             int roll = butchery - corpse_item.damage_level();
@@ -20,6 +20,7 @@ extern bool prevent_occlusion_transp;
 extern float prevent_occlusion_min_dist;
 extern float prevent_occlusion_max_dist;
 extern bool show_creature_overlay_icons;
+extern bool threaded_shadowcasting;
 extern bool use_tiles;
 extern bool use_far_tiles;
 extern bool use_pinyin_search;
@@ -260,6 +260,7 @@ cata_tiles::~cata_tiles() = default;
 
 void cata_tiles::on_options_changed()
 {
+    map_frame_cache_key.reset();
     memory_map_mode = get_option <std::string>( "MEMORY_MAP_MODE" );
 
     pixel_minimap_settings settings;
@@ -357,6 +358,9 @@ tile_type &tileset::create_tile_type( const std::string &id, tile_type &&new_til
 void cata_tiles::load_tileset( const std::string &tileset_id, const bool precheck,
                                const bool force, const bool pump_events, const bool terrain )
 {
+    // Also called after the game data was (re)loaded, which changes what looks_like points to
+    clear_tile_lookup_cache();
+    map_frame_cache_key.reset();
     if( tileset_ptr && tileset_ptr->get_tileset_id() == tileset_id && !force ) {
         return;
     }
@@ -376,6 +380,7 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
 
 void cata_tiles::reinit()
 {
+    map_frame_cache_key.reset();
     set_draw_scale( 16 );
     RenderClear( renderer );
 }
@@ -1327,6 +1332,10 @@ static std::map<tripoint_bub_ms, int> display_npc_attack_potential()
     return effectiveness_map;
 }
 
+// Counts calls to set_draw_cache_dirty. The map's flag is reset by whichever context draws
+// first, this tells every context about changes since its own last frame.
+static unsigned int draw_cache_generation = 0;
+
 void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int width, int height,
                        std::multimap<point, formatted_text> &overlay_strings,
                        color_block_overlay_container &color_blocks )
@@ -1456,6 +1465,28 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
     auto vision_cache = you.get_vision_modes();
     nv_goggles_activated = vision_cache[NV_GOGGLES];
 
+    // Redraws that happen without anything in the game changing, like those of menus opened on
+    // top of the map, can reuse the map part of the previous frame
+    const map_frame_key frame_key{ dest, width, height, center, o, tile_width, tile_height,
+                                   tileset_ptr.get(), calendar::turn, you.get_moves(),
+                                   draw_cache_generation, nv_goggles_activated, disable_occlusion,
+                                   g->displaying_overlays, g->displaying_visibility_creature,
+                                   g->displaying_lighting_condition
+                                 };
+    if( !here.draw_points_cache_dirty && map_frame_cache && map_frame_cache_key == frame_key &&
+        !has_draw_overrides() ) {
+        const SDL_Rect frame_rect = { dest.x, dest.y, width, height };
+        RenderCopy( renderer, map_frame_cache, nullptr, &frame_rect );
+        overlay_strings = here.overlay_strings_cache;
+        color_blocks = here.color_blocks_cache;
+        draw_animations_and_cursors( center, overlay_strings );
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        return;
+    }
+    map_frame_cache_key.reset();
+    drew_animated_tile = false;
+
     // check that the creature for which we'll draw the visibility map is still alive at that point
     if( g->display_overlay_state( ACTION_DISPLAY_VISIBILITY ) &&
         g->displaying_visibility_creature ) {
@@ -1882,6 +1913,32 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
         }
     }
 
+    if( !has_draw_overrides() && !drew_animated_tile ) {
+        store_map_frame( dest, width, height );
+        map_frame_cache_key = frame_key;
+    }
+
+    draw_animations_and_cursors( center, overlay_strings );
+
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                  "SDL_RenderSetClipRect failed" );
+}
+
+void cata_tiles::set_draw_cache_dirty()
+{
+    get_map().draw_points_cache_dirty = true;
+    draw_cache_generation++;
+}
+
+void cata_tiles::invalidate_map_frame_cache()
+{
+    map_frame_cache_key.reset();
+}
+
+void cata_tiles::draw_animations_and_cursors( const tripoint_bub_ms &center,
+        std::multimap<point, formatted_text> &overlay_strings )
+{
+    const avatar &you = get_avatar();
     in_animation = do_draw_explosion || do_draw_custom_explosion ||
                    do_draw_bullet || do_draw_hit || do_draw_line ||
                    do_draw_cursor || do_draw_highlight || do_draw_weather ||
@@ -1943,14 +2000,57 @@ void cata_tiles::draw( const point &dest, const tripoint_bub_ms &center, int wid
                                  0, 0, lit_level::LIT, false );
         }
     }
+}
 
-    printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
-                  "SDL_RenderSetClipRect failed" );
+bool cata_tiles::map_frame_key::operator==( const map_frame_key &rhs ) const
+{
+    return std::tie( dest, width, height, center, o, tile_width, tile_height, ts, turn, moves,
+                     draw_cache_generation, nv_goggles, disable_occlusion, overlay,
+                     visibility_creature, lighting_condition ) ==
+           std::tie( rhs.dest, rhs.width, rhs.height, rhs.center, rhs.o, rhs.tile_width,
+                     rhs.tile_height, rhs.ts, rhs.turn, rhs.moves, rhs.draw_cache_generation,
+                     rhs.nv_goggles, rhs.disable_occlusion, rhs.overlay, rhs.visibility_creature,
+                     rhs.lighting_condition );
 }
 
-void cata_tiles::set_draw_cache_dirty()
+bool cata_tiles::has_draw_overrides() const
 {
-    get_map().draw_points_cache_dirty = true;
+    return !radiation_override.empty() || !terrain_override.empty() ||
+           !furniture_override.empty() || !graffiti_override.empty() || !trap_override.empty() ||
+           !field_override.empty() || !item_override.empty() || !vpart_override.empty() ||
+           !draw_below_override.empty() || !monster_override.empty();
+}
+
+void cata_tiles::store_map_frame( const point &dest, const int width, const int height )
+{
+    // The frame is copied out of the render target it was drawn to
+    SDL_Texture *const target = SDL_GetRenderTarget( renderer.get() );
+    if( target == nullptr ) {
+        map_frame_cache.reset();
+        return;
+    }
+    int cache_width = 0;
+    int cache_height = 0;
+    if( map_frame_cache ) {
+        SDL_QueryTexture( map_frame_cache.get(), nullptr, nullptr, &cache_width, &cache_height );
+    }
+    if( !map_frame_cache || cache_width != width || cache_height != height ) {
+        map_frame_cache = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                         SDL_TEXTUREACCESS_TARGET, width, height );
+        if( !map_frame_cache ) {
+            return;
+        }
+    }
+    const SDL_Rect frame_rect = { dest.x, dest.y, width, height };
+    printErrorIf( SDL_SetRenderTarget( renderer.get(), map_frame_cache.get() ) != 0,
+                  "SDL_SetRenderTarget failed" );
+    printErrorIf( SDL_RenderCopy( renderer.get(), target, &frame_rect, nullptr ) != 0,
+                  "SDL_RenderCopy failed" );
+    printErrorIf( SDL_SetRenderTarget( renderer.get(), target ) != 0,
+                  "SDL_SetRenderTarget failed" );
+    // Switching targets drops the clipping, the rest of the frame still needs it
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), &frame_rect ) != 0,
+                  "SDL_RenderSetClipRect failed" );
 }
 
 void cata_tiles::draw_minimap( const point &dest, const tripoint_bub_ms &center, int width,
@@ -2292,6 +2392,31 @@ cata_tiles::find_tile_with_season( const std::string &id ) const
     return tileset_ptr->find_tile_type_by_season( id, season );
 }
 
+std::optional<tile_lookup_res>
+cata_tiles::find_tile_looks_like_cached( const std::string &id, TILE_CATEGORY category,
+        const std::string &variant ) const
+{
+    const season_type season = season_of_year( calendar::turn );
+    if( season != tile_lookup_cache_season ) {
+        clear_tile_lookup_cache();
+        tile_lookup_cache_season = season;
+    }
+    tile_lookups_by_variant &by_variant = tile_lookup_cache[static_cast<size_t>( category )][id];
+    auto found = by_variant.find( variant );
+    if( found == by_variant.end() ) {
+        found = by_variant.emplace( variant, find_tile_looks_like( id, category, variant ) ).first;
+    }
+    return found->second;
+}
+
+void cata_tiles::clear_tile_lookup_cache() const
+{
+    for( std::unordered_map<std::string, tile_lookups_by_variant> &by_id : tile_lookup_cache ) {
+        by_id.clear();
+    }
+    tile_lookup_cache_season.reset();
+}
+
 template<typename T>
 std::optional<tile_lookup_res>
 cata_tiles::find_tile_looks_like_by_string_id( std::string_view id, TILE_CATEGORY category,
@@ -2555,7 +2680,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
 
         // Adding to the id like this breaks the fragile string handling that vision level uses for looks_like.
         if( prevent_occlusion_transp && retract > 0 && category != TILE_CATEGORY::OVERMAP_VISION_LEVEL ) {
-            res = find_tile_looks_like( id + "_transparent", category, variant );
+            res = find_tile_looks_like_cached( id + "_transparent", category, variant );
             if( res ) {
                 tt = &res -> tile();
             }
@@ -2565,14 +2690,15 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
     // check if there is an available intensity tile and if there is use that instead of the basic tile
     // this is only relevant for fields
     if( intensity_level > 0 ) {
-        res = find_tile_looks_like( id + "_int" + std::to_string( intensity_level ), category, variant );
+        const std::string intensity_id = id + "_int" + std::to_string( intensity_level );
+        res = find_tile_looks_like_cached( intensity_id, category, variant );
         if( res ) {
             tt = &res -> tile();
         }
     }
     // if a tile with intensity hasn't already been found then fall back to a base tile
     if( !res ) {
-        res = find_tile_looks_like( id, category, variant );
+        res = find_tile_looks_like_cached( id, category, variant );
         if( res ) {
             tt = &res -> tile();
         }
@@ -2938,6 +3064,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
 
         // idle tile animations:
         if( display_tile.animated ) {
+            drew_animated_tile = true;
             // idle animations run during the user's turn, and the animation speed
             // needs to be defined by the tileset to look good, so we use system clock:
             std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
@@ -3726,7 +3853,7 @@ bool cata_tiles::draw_field_or_item( const tripoint_bub_ms &p, const lit_level l
     if( !fld_overridden ) {
         const maptile &tile = here.maptile_at( p );
 
-        for( const std::pair<const field_type_id, field_entry> &fd_pr : f ) {
+        for( const std::pair<field_type_id, field_entry> &fd_pr : f ) {
             const field_type_id &fld = fd_pr.first;
             if( !invisible[0] && fld.obj().display_field ) {
                 const lit_level lit = ll;
@@ -3735,7 +3862,7 @@ bool cata_tiles::draw_field_or_item( const tripoint_bub_ms &p, const lit_level l
                 const bool invis ) -> field_type_id {
                     // go through the fields and see if they are equal
                     field_type_id found = fd_null;
-                    for( std::pair<const field_type_id, field_entry> &this_fld : here.field_at( q ) )
+                    for( std::pair<field_type_id, field_entry> &this_fld : here.field_at( q ) )
                     {
                         if( this_fld.first == fld ) {
                             found = fld;
@@ -39,6 +39,7 @@ class memorized_tile;
 class monster;
 class nc_color;
 class pixel_minimap;
+enum action_id : int;
 enum class direction : unsigned int;
 enum class lit_level : int;
 enum class visibility_type : int;
@@ -494,6 +495,11 @@ class cata_tiles
                                       std::string &draw_id );
 
     private:
+        // find_tile_looks_like for drawing, answered from tile_lookup_cache when possible
+        std::optional<tile_lookup_res> find_tile_looks_like_cached( const std::string &id,
+                TILE_CATEGORY category, const std::string &variant ) const;
+        void clear_tile_lookup_cache() const;
+
         bool draw_from_id_string_internal( const std::string &id, const tripoint_bub_ms &pos, int subtile,
                                            int rota,
                                            lit_level ll, int retract, bool apply_night_vision_goggles, int &height_3d );
@@ -804,6 +810,18 @@ class cata_tiles
         tileset_cache &cache;
         std::shared_ptr<const tileset> tileset_ptr;
 
+        /**
+         * Results of find_tile_looks_like per category, id and variant, so every sprite goes
+         * through the variant, season and looks_like fallbacks only once.
+         * Only valid for the tileset and game data it was filled from, cleared by load_tileset,
+         * and for tile_lookup_cache_season, cleared when the season changes.
+         */
+        using tile_lookups_by_variant =
+            std::unordered_map<std::string, std::optional<tile_lookup_res>>;
+        mutable std::array<std::unordered_map<std::string, tile_lookups_by_variant>,
+                static_cast<size_t>( TILE_CATEGORY::last )> tile_lookup_cache;
+        mutable std::optional<season_type> tile_lookup_cache_season;
+
         // the scaled default sprite width and height. in non-isometric mode,
         // the basic tile width and height equal the default sprite width and
         // height, but in isometric mode, the basic tile height is always
@@ -820,6 +838,45 @@ class cata_tiles
 
         int fog_alpha = 0;
 
+        /**
+         * Everything that goes into the map part of a frame. When it is unchanged, and the draw
+         * cache wasn't marked dirty since, the copy in map_frame_cache can be shown instead of
+         * drawing all tiles again. There is no telling whether creatures, lighting or fields
+         * changed in between, so the frame is only reused within the same turn and move.
+         */
+        struct map_frame_key {
+            point dest;
+            int width;
+            int height;
+            tripoint_bub_ms center;
+            point o;
+            int tile_width;
+            int tile_height;
+            const tileset *ts;
+            time_point turn;
+            int moves;
+            unsigned int draw_cache_generation;
+            bool nv_goggles;
+            bool disable_occlusion;
+            // Debug overlays (scent, radiation, lighting, visibility...) drawn over the tiles
+            std::optional<action_id> overlay;
+            const Creature *visibility_creature;
+            int lighting_condition;
+
+            bool operator==( const map_frame_key &rhs ) const;
+        };
+        SDL_Texture_Ptr map_frame_cache;
+        std::optional<map_frame_key> map_frame_cache_key;
+        // Frames with idle tile animations keep changing and are not cached
+        bool drew_animated_tile = false;
+
+        bool has_draw_overrides() const;
+        // Copies the map part of the frame that was just drawn into map_frame_cache
+        void store_map_frame( const point &dest, int width, int height );
+        // Everything drawn on top of the map tiles: animations, cursors and footsteps
+        void draw_animations_and_cursors( const tripoint_bub_ms &center,
+                                          std::multimap<point, formatted_text> &overlay_strings );
+
         bool in_animation = false;
 
         bool disable_occlusion = false;
@@ -896,6 +953,8 @@ class cata_tiles
     public:
         // Draw caches persist data between draws and are only recalculated when dirty
         void set_draw_cache_dirty();
+        // Forgets the map part of the last frame, needed when the render targets were lost
+        void invalidate_map_frame_cache();
 
         std::string memory_map_mode = "color_pixel_sepia";
 };
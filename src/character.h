@@ -1934,8 +1934,9 @@ class Character : public Creature, public visitable
         struct has_mission_item_filter {
             int mission_id;
             bool operator()( const item &it ) const {
-                return it.mission_id == mission_id || it.has_any_with( [&]( const item & it ) {
-                    return it.mission_id == mission_id;
+                return it.get_mission_id() == mission_id ||
+                       it.has_any_with( [&]( const item & it ) {
+                    return it.get_mission_id() == mission_id;
                 }, pocket_type::E_FILE_STORAGE );
             }
         };
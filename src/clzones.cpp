@@ -104,6 +104,8 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_bounds.clear();
+    vzone_bounds.clear();
 }
 
 std::string zone_type::name() const
@@ -891,6 +893,7 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    area_bounds.clear();
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.pos_abs();
     for( zone_data &elem : zones ) {
@@ -906,6 +909,7 @@ void zone_manager::cache_data( bool update_avatar )
 
         const std::string &type_hash = elem.get_type_hash();
         auto &cache = area_cache[type_hash];
+        area_bounds[type_hash].emplace_back( elem.get_start_point(), elem.get_end_point() );
 
         // Draw marked area
         for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
@@ -946,6 +950,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    vzone_bounds.clear();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -955,6 +960,7 @@ void zone_manager::cache_vzones( map *pmap )
 
         const std::string &type_hash = elem->get_type_hash();
         auto &cache = vzone_cache[type_hash];
+        vzone_bounds[type_hash].emplace_back( elem->get_start_point(), elem->get_end_point() );
 
         // TODO: looks very similar to the above cache_data - maybe merge it?
 
@@ -966,12 +972,14 @@ void zone_manager::cache_vzones( map *pmap )
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+static const std::unordered_set<tripoint_abs_ms> no_points;
+
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_points;
     }
 
     return type_iter->second;
@@ -988,7 +996,8 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
 {
     std::unordered_set<tripoint_bub_ms> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
+    for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache :
+         area_cache ) {
         zone_type_id type = zone_data::unhash_type( cache.first );
         faction_id z_fac = zone_data::unhash_fac( cache.first );
         if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
@@ -999,7 +1008,8 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
             }
         }
     }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+    for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache :
+         vzone_cache ) {
         zone_type_id type = zone_data::unhash_type( cache.first );
         faction_id z_fac = zone_data::unhash_fac( cache.first );
         if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
@@ -1012,7 +1022,8 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
     }
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+        for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache :
+             vzone_cache ) {
             zone_type_id type = zone_data::unhash_type( cache.first );
             if( type == zone_type_NO_NPC_PICKUP ) {
                 for( tripoint_abs_ms point : cache.second ) {
@@ -1025,13 +1036,13 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_points;
     }
 
     return type_iter->second;
@@ -1045,20 +1056,49 @@ bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
     return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
 }
 
+// The tiles two areas have in common, if there are any
+static std::optional<inclusive_cuboid<tripoint_abs_ms>> area_overlap(
+            const inclusive_cuboid<tripoint_abs_ms> &a, const inclusive_cuboid<tripoint_abs_ms> &b )
+{
+    const tripoint_abs_ms p_min( std::max( a.p_min.x(), b.p_min.x() ),
+                                 std::max( a.p_min.y(), b.p_min.y() ),
+                                 std::max( a.p_min.z(), b.p_min.z() ) );
+    const tripoint_abs_ms p_max( std::min( a.p_max.x(), b.p_max.x() ),
+                                 std::min( a.p_max.y(), b.p_max.y() ),
+                                 std::min( a.p_max.z(), b.p_max.z() ) );
+    if( p_min.x() > p_max.x() || p_min.y() > p_max.y() || p_min.z() > p_max.z() ) {
+        return std::nullopt;
+    }
+    return inclusive_cuboid<tripoint_abs_ms>( p_min, p_max );
+}
+
+// Tiles within range of where. Vehicle zones only count on the same z-level.
+static inclusive_cuboid<tripoint_abs_ms> near_area( const tripoint_abs_ms &where, int range,
+        bool same_z )
+{
+    const tripoint_rel_ms reach( range, range, same_z ? 0 : range );
+    return inclusive_cuboid<tripoint_abs_ms>( where - reach, where + reach );
+}
+
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            return true;
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    const auto area_iter = area_bounds.find( type_hash );
+    if( area_iter != area_bounds.end() ) {
+        const inclusive_cuboid<tripoint_abs_ms> near = near_area( where, range, false );
+        for( const inclusive_cuboid<tripoint_abs_ms> &area : area_iter->second ) {
+            if( area_overlap( area, near ) ) {
+                return true;
+            }
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
+    const auto vzone_iter = vzone_bounds.find( type_hash );
+    if( vzone_iter != vzone_bounds.end() ) {
+        const inclusive_cuboid<tripoint_abs_ms> near = near_area( where, range, true );
+        for( const inclusive_cuboid<tripoint_abs_ms> &area : vzone_iter->second ) {
+            if( area_overlap( area, near ) ) {
                 return true;
             }
         }
@@ -1138,6 +1178,24 @@ std::vector<zone_data const *> zone_manager::get_zones_at( const tripoint_abs_ms
     return ret;
 }
 
+// Whether the filter of a LOOT_CUSTOM or LOOT_ITEM_GROUP zone takes the item
+static bool custom_loot_zone_accepts( const zone_data &zone, const item &it )
+{
+    item const *const check_it = it.this_or_single_content();
+    loot_options const &options = dynamic_cast<const loot_options &>( zone.get_options() );
+    std::string const filter_string = options.get_mark();
+    if( zone.get_type() == zone_type_LOOT_CUSTOM ) {
+        auto const z = item_filter_from_string( filter_string );
+        return z( *check_it ) || ( check_it != &it && z( it ) );
+    } else if( zone.get_type() == zone_type_LOOT_ITEM_GROUP ) {
+        return item_group::group_contains_item( item_group_id( filter_string ),
+                                                check_it->typeId() ) ||
+               ( check_it != &it &&
+                 item_group::group_contains_item( item_group_id( filter_string ), it.typeId() ) );
+    }
+    return false;
+}
+
 bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it,
                                     const zone_type_id &ztype, const faction_id &fac ) const
 {
@@ -1145,22 +1203,8 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
     if( zones.empty() || !it ) {
         return false;
     }
-    item const *const check_it = it->this_or_single_content();
     for( zone_data const *zone : zones ) {
-        loot_options const &options = dynamic_cast<const loot_options &>( zone->get_options() );
-        std::string const filter_string = options.get_mark();
-        bool has = false;
-        if( ztype == zone_type_LOOT_CUSTOM ) {
-            auto const z = item_filter_from_string( filter_string );
-            has = z( *check_it ) || ( check_it != it && z( *it ) );
-        } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
-            has = item_group::group_contains_item( item_group_id( filter_string ),
-                                                   check_it->typeId() ) ||
-                  ( check_it != it &&
-                    item_group::group_contains_item( item_group_id( filter_string ),
-                            it->typeId() ) );
-        }
-        if( has ) {
+        if( custom_loot_zone_accepts( *zone, *it ) ) {
             return true;
         }
     }
@@ -1168,6 +1212,59 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
     return false;
 }
 
+bool zone_manager::has_near_for_item( const zone_type_id &type, const tripoint_abs_ms &where,
+                                      int range, const item &it, const faction_id &fac ) const
+{
+    if( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) {
+        return has_near( type, where, range, fac );
+    }
+
+    // The same zones custom_loot_has would look at, but only those taking the item
+    std::vector<inclusive_cuboid<tripoint_abs_ms>> accepting;
+    const auto add_if_accepting = [&]( const zone_data & zone ) {
+        if( zone.get_type() == type && zone.get_faction() == fac &&
+            custom_loot_zone_accepts( zone, it ) ) {
+            accepting.emplace_back( zone.get_start_point(), zone.get_end_point() );
+        }
+    };
+    for( const zone_data &zone : zones ) {
+        add_if_accepting( zone );
+    }
+    map &here = get_map();
+    for( const zone_data *zone : here.get_vehicle_zones( here.get_abs_sub().z() ) ) {
+        add_if_accepting( *zone );
+    }
+    if( accepting.empty() ) {
+        return false;
+    }
+
+    // A tile in range that is part of an enabled zone and of an accepting one
+    const auto any_accepting = [&]( const std::vector<inclusive_cuboid<tripoint_abs_ms>> &areas,
+    const inclusive_cuboid<tripoint_abs_ms> &near ) {
+        for( const inclusive_cuboid<tripoint_abs_ms> &area : areas ) {
+            std::optional<inclusive_cuboid<tripoint_abs_ms>> near_part = area_overlap( area, near );
+            if( !near_part ) {
+                continue;
+            }
+            for( const inclusive_cuboid<tripoint_abs_ms> &taking : accepting ) {
+                if( area_overlap( *near_part, taking ) ) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    const auto area_iter = area_bounds.find( type_hash );
+    if( area_iter != area_bounds.end() &&
+        any_accepting( area_iter->second, near_area( where, range, false ) ) ) {
+        return true;
+    }
+    const auto vzone_iter = vzone_bounds.find( type_hash );
+    return vzone_iter != vzone_bounds.end() &&
+           any_accepting( vzone_iter->second, near_area( where, range, true ) );
+}
+
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
@@ -1241,15 +1338,11 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
 {
     const item_category &cat = it.get_category_of_contents();
 
-    if( has_near( zone_type_LOOT_CUSTOM, where, range, fac ) ) {
-        if( !get_near( zone_type_LOOT_CUSTOM, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_CUSTOM;
-        }
+    if( has_near_for_item( zone_type_LOOT_CUSTOM, where, range, it, fac ) ) {
+        return zone_type_LOOT_CUSTOM;
     }
-    if( has_near( zone_type_LOOT_ITEM_GROUP, where, range, fac ) ) {
-        if( !get_near( zone_type_LOOT_ITEM_GROUP, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_ITEM_GROUP;
-        }
+    if( has_near_for_item( zone_type_LOOT_ITEM_GROUP, where, range, it, fac ) ) {
+        return zone_type_LOOT_ITEM_GROUP;
     }
     if( it.has_flag( json_flag_FIREWOOD ) ) {
         if( has_near( zone_type_LOOT_WOOD, where, range, fac ) ) {
@@ -1306,31 +1399,23 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
         if( it_food != nullptr ) {
             if( it_food->get_comestible()->comesttype == "DRINK" ) {
                 if( perishable && has_near( zone_type_LOOT_PDRINK, where, range, fac ) ) {
-                    if( !get_near( zone_type_LOOT_PDRINK, where, range, &it, fac ).empty() ) {
-                        return zone_type_LOOT_PDRINK;
-                    }
+                    return zone_type_LOOT_PDRINK;
                 } else if( has_near( zone_type_LOOT_DRINK, where, range, fac ) ) {
-                    if( !get_near( zone_type_LOOT_DRINK, where, range, &it, fac ).empty() ) {
-                        return zone_type_LOOT_DRINK;
-                    }
+                    return zone_type_LOOT_DRINK;
                 }
             }
 
             if( perishable && has_near( zone_type_LOOT_PFOOD, where, range, fac ) ) {
-                if( !get_near( zone_type_LOOT_PFOOD, where, range, &it, fac ).empty() ) {
-                    return zone_type_LOOT_PFOOD;
-                }
+                return zone_type_LOOT_PFOOD;
             }
         }
-        if( !get_near( zone_type_LOOT_FOOD, where, range, &it, fac ).empty() ) {
+        if( has_near( zone_type_LOOT_FOOD, where, range, fac ) ) {
             return zone_type_LOOT_FOOD;
         }
     }
 
     if( has_near( zone_type_LOOT_DEFAULT, where, range, fac ) ) {
-        if( !get_near( zone_type_LOOT_DEFAULT, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_DEFAULT;
-        }
+        return zone_type_LOOT_DEFAULT;
     }
 
     return zone_type_id();
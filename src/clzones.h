@@ -559,10 +559,20 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
+        // The areas behind area_cache and vzone_cache, so distance checks don't need
+        // to visit every tile
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> area_bounds;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> vzone_bounds;
+        const std::unordered_set<tripoint_abs_ms> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+        // Like !get_near( type, where, range, &it, fac ).empty(), but checks the filter of
+        // each zone once instead of once per tile
+        bool has_near_for_item( const zone_type_id &type, const tripoint_abs_ms &where, int range,
+                                const item &it, const faction_id &fac ) const;
     public:
         zone_manager();
         ~zone_manager() = default;
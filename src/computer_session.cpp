@@ -1019,7 +1019,7 @@ void computer_session::action_download_software()
 
     if( item *const estorage = pick_estorage( downloaded_size ) ) {
         get_player_character().mod_moves( -to_moves<int>( 1_seconds ) * 0.3 );
-        software.mission_id = comp.mission_id;
+        software.set_mission_id( comp.mission_id );
         estorage->put_in( software, pocket_type::E_FILE_STORAGE );
         print_line( string_format( _( "%s downloaded." ), software.tname() ) );
     } else {
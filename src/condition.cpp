@@ -2167,7 +2167,7 @@ conditional_t::func f_is_in_field( const JsonObject &jo, std::string_view member
     str_or_var field_type = get_str_or_var( jo.get_member( member ), member, true );
     return [field_type, is_npc, &here]( const_dialogue const & d ) {
         field_type_id ft = field_type_id( field_type.evaluate( d ) );
-        for( const std::pair<const field_type_id, field_entry> &f : here.field_at( d.const_actor(
+        for( const std::pair<field_type_id, field_entry> &f : here.field_at( d.const_actor(
                     is_npc )->pos_bub( here ) ) ) {
             if( f.second.get_field_type() == ft ) {
                 return true;
@@ -228,18 +228,35 @@ struct availability {
             std::string reason;
             craft_flags flag = camp_crafting ? craft_flags::none : craft_flags::start_only;
 
+            const auto can_make_with = [&]( const std::function<bool( const item & )> &filter ) {
+                return req.can_make_with_inventory( inv, filter, batch_size, flag );
+            };
+            std::optional<bool> has_components;
+            const auto can_make_with_all_items = [&]() {
+                if( !has_components ) {
+                    has_components = can_make_with( all_items_filter );
+                }
+                return *has_components;
+            };
+
             if( crafter.is_npc() && !r->npc_can_craft( reason ) && !camp_crafting ) {
                 can_craft = false;
             } else if( r->is_nested() ) {
                 can_craft = check_can_craft_nested( _crafter, *r );
             } else {
                 can_craft = ( !r->is_practice() || has_all_skills ) && has_proficiencies &&
-                            req.can_make_with_inventory( inv, all_items_filter, batch_size, flag );
+                            can_make_with_all_items();
+            }
+            // The other filters only reject more items, so they can't do better than all items
+            // and only differ from it when the inventory has items for them to reject.
+            if( !can_make_with_all_items() ) {
+                would_use_rotten = true;
+                would_use_favorite = true;
+            } else {
+                would_use_rotten = inv.has_rotten_items() && !can_make_with( no_rotten_filter );
+                would_use_favorite = inv.has_favorite_items() &&
+                                     !can_make_with( no_favorite_filter );
             }
-            would_use_rotten = !req.can_make_with_inventory( inv, no_rotten_filter, batch_size,
-                               flag );
-            would_use_favorite = !req.can_make_with_inventory( inv, no_favorite_filter, batch_size,
-                                 flag );
             useless_practice = r->is_practice() && cannot_gain_skill_or_prof( crafter, *r );
             is_nested_category = r->is_nested();
             const requirement_data &simple_req = r->simple_requirements();
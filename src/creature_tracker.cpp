@@ -1,6 +1,8 @@
 #include "creature_tracker.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -14,6 +16,7 @@
 #include "game.h"
 #include "map.h"
 #include "mapdata.h"
+#include "map_scale_constants.h"
 #include "maptile_fwd.h"
 #include "mongroup.h"
 #include "monster.h"
@@ -93,7 +96,7 @@ bool creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos_abs()] = critter_ptr;
+    set_location( critter.pos_abs(), critter_ptr );
     return true;
 }
 
@@ -130,8 +133,8 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( old_pos );
-        monsters_by_location[new_pos] = *iter;
+        erase_location( old_pos );
+        set_location( new_pos, *iter );
         return true;
     } else {
         // We're changing the x/y/z coordinates of a zombie that hasn't been added
@@ -148,7 +151,7 @@ void creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.pos_abs() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( pos_iter );
         return;
     }
 
@@ -159,10 +162,105 @@ void creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        erase_location( iter );
     }
 }
 
+void creature_tracker::set_location( const tripoint_abs_ms &pos,
+                                     const shared_ptr_fast<monster> &critter )
+{
+    erase_location( pos );
+    monsters_by_location.emplace( pos, critter );
+    monsters_by_submap[project_to<coords::sm>( pos )].push_back( critter.get() );
+}
+
+void creature_tracker::erase_location( const tripoint_abs_ms &pos )
+{
+    const auto iter = monsters_by_location.find( pos );
+    if( iter != monsters_by_location.end() ) {
+        erase_location( iter );
+    }
+}
+
+void creature_tracker::erase_location(
+    std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>>::iterator iter )
+{
+    const auto bucket = monsters_by_submap.find( project_to<coords::sm>( iter->first ) );
+    if( bucket != monsters_by_submap.end() ) {
+        std::vector<monster *> &critters = bucket->second;
+        critters.erase( std::remove( critters.begin(), critters.end(), iter->second.get() ),
+                        critters.end() );
+        if( critters.empty() ) {
+            monsters_by_submap.erase( bucket );
+        }
+    }
+    monsters_by_location.erase( iter );
+}
+
+void creature_tracker::clear_locations()
+{
+    monsters_by_location.clear();
+    monsters_by_submap.clear();
+}
+
+std::vector<monster *> creature_tracker::monsters_in_range( const tripoint_abs_ms &center,
+        int radius ) const
+{
+    std::vector<monster *> result;
+    // Monsters only live in the reality bubble, anything bigger than that is as good as no limit
+    if( radius < 0 || radius > MAPSIZE_X ) {
+        radius = MAPSIZE_X;
+    }
+    const int min_z = std::max( center.z() - radius, -OVERMAP_DEPTH );
+    const int max_z = std::min( center.z() + radius, OVERMAP_HEIGHT );
+    const bool unlimited = radius == MAPSIZE_X;
+    const auto in_range = [&]( const tripoint_abs_ms & p ) {
+        return unlimited || ( std::abs( p.x() - center.x() ) <= radius &&
+                              std::abs( p.y() - center.y() ) <= radius &&
+                              p.z() >= min_z && p.z() <= max_z );
+    };
+    const point_abs_sm min_sm = project_to<coords::sm>( center.xy() - point( radius, radius ) );
+    const point_abs_sm max_sm = project_to<coords::sm>( center.xy() + point( radius, radius ) );
+    const int64_t num_submaps = static_cast<int64_t>( max_sm.x() - min_sm.x() + 1 ) *
+                                ( max_sm.y() - min_sm.y() + 1 ) * ( max_z - min_z + 1 );
+    if( unlimited || num_submaps > static_cast<int64_t>( monsters_by_submap.size() ) ) {
+        // The box covers most of the bubble, looking up every submap in it would take
+        // longer than going through the monsters.
+        for( const shared_ptr_fast<monster> &critter : monsters_list ) {
+            if( !critter->is_dead() && in_range( critter->pos_abs() ) ) {
+                result.push_back( critter.get() );
+            }
+        }
+        return result;
+    }
+    for( int z = min_z; z <= max_z; ++z ) {
+        for( int y = min_sm.y(); y <= max_sm.y(); ++y ) {
+            for( int x = min_sm.x(); x <= max_sm.x(); ++x ) {
+                const auto bucket = monsters_by_submap.find( tripoint_abs_sm( x, y, z ) );
+                if( bucket == monsters_by_submap.end() ) {
+                    continue;
+                }
+                for( monster *critter : bucket->second ) {
+                    if( !critter->is_dead() && in_range( critter->pos_abs() ) ) {
+                        result.push_back( critter );
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+bool creature_tracker::is_dead( const monster &critter )
+{
+    return critter.is_dead();
+}
+
+const mfaction_id &creature_tracker::faction_of( const monster &critter )
+{
+    return critter.faction;
+}
+
 void creature_tracker::remove( const monster &critter )
 {
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
@@ -182,7 +280,7 @@ void creature_tracker::remove( const monster &critter )
 void creature_tracker::clear()
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_locations();
     removed_this_turn_.clear();
     creatures_by_zone_and_faction_.clear();
     invalidate_reachability_cache();
@@ -190,9 +288,9 @@ void creature_tracker::clear()
 
 void creature_tracker::rebuild_cache()
 {
-    monsters_by_location.clear();
+    clear_locations();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos_abs()] = mon_ptr;
+        set_location( mon_ptr->pos_abs(), mon_ptr );
     }
 }
 
@@ -235,13 +333,13 @@ void creature_tracker::swap_positions( monster &first, monster &second )
     shared_ptr_fast<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
+        erase_location( first_iter );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+        erase_location( second_iter );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -251,10 +349,10 @@ void creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos_abs()] = first_ptr;
+        set_location( first.pos_abs(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos_abs()] = second_ptr;
+        set_location( second.pos_abs(), second_ptr );
     }
 }
 
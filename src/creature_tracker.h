@@ -70,6 +70,29 @@ class creature_tracker
         void for_each_reachable( const Creature &origin, FactionPredicateFn &&faction_fn,
                                  CreatureVisitFn &&creature_fn );
 
+        /**
+         * Visits the monsters at most @p radius tiles away from @p center along each
+         * axis (z included). That is a box, so callers still do their own distance check.
+         * Only the submaps overlapping the box are looked at, which is much cheaper than
+         * going through all monsters when the radius is small. A negative radius means
+         * no limit, as with map::sees.
+         * The visitor may move, spawn or kill monsters.
+         *  - VisitFn: void(monster&)
+         * Dead monsters are ignored and not visited.
+         */
+        template <typename VisitFn>
+        void for_each_monster_in_range( const tripoint_abs_ms &center, int radius,
+                                        VisitFn &&visit_fn );
+
+        /**
+         * As above, for the monsters whose faction matches the given predicate.
+         *  - FactionPredicateFn: bool(const mfaction_id&)
+         *  - VisitFn: void(monster&)
+         */
+        template <typename FactionPredicateFn, typename VisitFn>
+        void for_each_monster_in_range( const tripoint_abs_ms &center, int radius,
+                                        FactionPredicateFn &&faction_fn, VisitFn &&visit_fn );
+
         /**
          * Returns a temporary id of the given monster (which must exist in the tracker).
          * The id is valid until monsters are added or removed from the tracker.
@@ -136,6 +159,21 @@ class creature_tracker
     private:
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
+        /**
+         * The only ways @ref monsters_by_location should be changed, they keep
+         * @ref monsters_by_submap in sync with it.
+         */
+        void set_location( const tripoint_abs_ms &pos, const shared_ptr_fast<monster> &critter );
+        void erase_location( const tripoint_abs_ms &pos );
+        void erase_location(
+            std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>>::iterator iter );
+        void clear_locations();
+
+        /** Living monsters in the box of @ref for_each_monster_in_range. */
+        std::vector<monster *> monsters_in_range( const tripoint_abs_ms &center, int radius ) const;
+        // monster is incomplete here, these are for the templates above
+        static bool is_dead( const monster &critter );
+        static const mfaction_id &faction_of( const monster &critter );
 
         void flood_fill_zone( const Creature &origin );
 
@@ -148,6 +186,12 @@ class creature_tracker
         std::vector<shared_ptr_fast<monster>> monsters_list;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * The same monsters as @ref monsters_by_location, bucketed by the submap they
+         * are in, for range queries. In the order they were put there.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<tripoint_abs_sm, std::vector<monster *>> monsters_by_submap;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -228,4 +272,27 @@ void creature_tracker::for_each_reachable( const Creature &origin, FactionPredic
     } );
 }
 
+template <typename VisitFn>
+void creature_tracker::for_each_monster_in_range( const tripoint_abs_ms &center, int radius,
+        VisitFn &&visit_fn )
+{
+    for( monster *critter : monsters_in_range( center, radius ) ) {
+        // An earlier visit may have killed it
+        if( !is_dead( *critter ) ) {
+            visit_fn( *critter );
+        }
+    }
+}
+
+template <typename FactionPredicateFn, typename VisitFn>
+void creature_tracker::for_each_monster_in_range( const tripoint_abs_ms &center, int radius,
+        FactionPredicateFn &&faction_fn, VisitFn &&visit_fn )
+{
+    for( monster *critter : monsters_in_range( center, radius ) ) {
+        if( !is_dead( *critter ) && faction_fn( faction_of( *critter ) ) ) {
+            visit_fn( *critter );
+        }
+    }
+}
+
 #endif // CATA_SRC_CREATURE_TRACKER_H
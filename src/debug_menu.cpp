@@ -105,6 +105,7 @@
 #include "overmapbuffer.h"
 #include "path_info.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "pimpl.h"
 #include "point.h"
 #include "popup.h"
@@ -269,6 +270,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::DISPLAY_TRANSPARENCY: return "DISPLAY_TRANSPARENCY";
         case debug_menu::debug_menu_index::DISPLAY_RADIATION: return "DISPLAY_RADIATION";
         case debug_menu::debug_menu_index::HOUR_TIMER: return "HOUR_TIMER";
+        case debug_menu::debug_menu_index::TURN_PROFILER: return "TURN_PROFILER";
         case debug_menu::debug_menu_index::CHANGE_SPELLS: return "CHANGE_SPELLS";
         case debug_menu::debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION: return "TEST_MAP_EXTRA_DISTRIBUTION";
         case debug_menu::debug_menu_index::NESTED_MAPGEN: return "NESTED_MAPGEN";
@@ -968,6 +970,7 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::SHOW_MUT_CAT, true, 'm', _( "Show mutation category levels" ) ) },
             { uilist_entry( debug_menu_index::BENCHMARK, true, 'b', _( "Draw benchmark (X seconds)" ) ) },
             { uilist_entry( debug_menu_index::HOUR_TIMER, true, 'E', _( "Toggle hour timer" ) ) },
+            { uilist_entry( debug_menu_index::TURN_PROFILER, true, 'P', _( "Turn profiler" ) ) },
             { uilist_entry( debug_menu_index::TRAIT_GROUP, true, 't', _( "Test trait group" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_PATH, true, 'n', _( "Toggle NPC pathfinding on map" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_ATTACK, true, 'A', _( "Toggle NPC attack potential values on map" ) ) },
@@ -3310,6 +3313,53 @@ static void display_talk_topic()
     }
 }
 
+static void debug_menu_turn_profiler()
+{
+    turn_profiler &profiler = turn_profiler::get();
+    uilist profmenu;
+    profmenu.text = string_format( _( "%d turns recorded" ),
+                                   static_cast<int>( profiler.num_recorded_turns() ) );
+    profmenu.addentry( 0, true, MENU_AUTOASSIGN,
+                       profiler.enabled() ? _( "Stop recording" ) : _( "Start recording" ) );
+    const bool recorded = profiler.num_recorded_turns() > 0;
+    profmenu.addentry( 1, recorded, MENU_AUTOASSIGN, _( "Show summary" ) );
+    profmenu.addentry( 2, recorded, MENU_AUTOASSIGN,
+                       _( "Write Chrome trace to turn_profile.json" ) );
+    profmenu.addentry( 3, recorded, MENU_AUTOASSIGN,
+                       _( "Forget recorded turns" ) );
+    profmenu.query();
+    switch( profmenu.ret ) {
+        case 0:
+            profiler.set_enabled( !profiler.enabled() );
+            break;
+        case 1: {
+            const auto new_win = []() {
+                return catacurses::newwin( FULL_SCREEN_HEIGHT, FULL_SCREEN_WIDTH,
+                                           point( std::max( 0, ( TERMX - FULL_SCREEN_WIDTH ) / 2 ),
+                                                  std::max( 0, ( TERMY - FULL_SCREEN_HEIGHT ) / 2 ) ) );
+            };
+            scrollable_text( new_win, _( "Turn profile" ), profiler.summary() );
+            break;
+        }
+        case 2: {
+            // Next to debug.log
+            const cata_path trace_path = PATH_INFO::config_dir_path() / "turn_profile.json";
+            const bool written = write_to_file( trace_path, [&]( std::ostream & fout ) {
+                profiler.write_chrome_trace( fout );
+            }, "turn profile" );
+            if( written ) {
+                popup( _( "Turn profile written to %s" ), trace_path.generic_u8string() );
+            }
+            break;
+        }
+        case 3:
+            profiler.clear();
+            break;
+        default:
+            break;
+    }
+}
+
 static void debug_menu_force_temperature()
 {
     uilist tempmenu;
@@ -4296,6 +4346,9 @@ void debug()
         case debug_menu_index::HOUR_TIMER:
             g->toggle_debug_hour_timer();
             break;
+        case debug_menu_index::TURN_PROFILER:
+            debug_menu_turn_profiler();
+            break;
         case debug_menu_index::CHANGE_TIME:
             calendar::turn = calendar_ui::select_time_point( calendar::turn );
             break;
@@ -55,6 +55,7 @@
 #include "output.h"
 #include "overmap_ui.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "pimpl.h"
 #include "player_activity.h"
 #include "point.h"
@@ -267,6 +268,7 @@ namespace
 {
 void monmove()
 {
+    turn_profile_scope profile( "monmove" );
     g->cleanup_dead();
     map &m = get_map();
     avatar &u = get_avatar();
@@ -405,6 +407,7 @@ void monmove()
 
 void overmap_npc_move()
 {
+    turn_profile_scope profile( "overmap_npc_move" );
     avatar &u = get_avatar();
     std::vector<npc *> travelling_npcs;
     static constexpr int move_search_radius = 600;
@@ -459,6 +462,7 @@ bool do_turn()
     if( g->is_game_over() ) {
         return turn_handler::cleanup_at_end();
     }
+    turn_profile_turn profile_turn( to_turns<int>( calendar::turn - calendar::turn_zero ) );
 
     weather_manager &weather = get_weather();
     // Actual stuff
@@ -532,18 +536,30 @@ bool do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
+    bool autosaved = false;
     if( get_option<bool>( "AUTOSAVE" ) &&
         calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
         !u.is_dead_state() ) {
         g->autosave();
+        autosaved = true;
+    }
+
+    // Creating an overmap can take seconds. When heading for one that doesn't exist
+    // yet, do it while the player isn't waiting on the game: asleep, busy with an
+    // activity, or right after an autosave that paused the game anyway.
+    if( autosaved || u.in_sleep_state() || u.activity ) {
+        overmap_buffer.create_neighbor_ahead( u.pos_abs_omt(), OMAPX / 4 );
     }
 
     weather.update_weather();
     g->reset_light_level();
 
     g->perhaps_add_random_npc( /* ignore_spawn_timers_and_rates = */ false );
-    while( u.get_moves() > 0 && u.activity ) {
-        u.activity.do_turn( u );
+    if( u.get_moves() > 0 && u.activity ) {
+        turn_profile_scope profile( "player_activity" );
+        while( u.get_moves() > 0 && u.activity ) {
+            u.activity.do_turn( u );
+        }
     }
 
     // Process NPC sound events before they move or they hear themselves talking
@@ -118,6 +118,75 @@ field::field()
 {
 }
 
+field::field( const field &other ) : _displayed_field_type( other._displayed_field_type )
+{
+    copy_entries( other );
+}
+
+field::field( field &&other ) noexcept : _displayed_field_type( other._displayed_field_type )
+{
+    for( size_t i = 0; i < other.num_inline; ++i ) {
+        new( inline_entries() + i ) value_type( other.inline_entries()[i] );
+    }
+    num_inline = other.num_inline;
+    overflow = std::move( other.overflow );
+    other.num_inline = 0;
+}
+
+field &field::operator=( const field &rhs )
+{
+    if( this != &rhs ) {
+        copy_entries( rhs );
+        _displayed_field_type = rhs._displayed_field_type;
+    }
+    return *this;
+}
+
+field &field::operator=( field &&rhs ) noexcept
+{
+    if( this != &rhs ) {
+        // The entries are trivially destructible, so they can be overwritten in place
+        for( size_t i = 0; i < rhs.num_inline; ++i ) {
+            new( inline_entries() + i ) value_type( rhs.inline_entries()[i] );
+        }
+        num_inline = rhs.num_inline;
+        overflow = std::move( rhs.overflow );
+        rhs.num_inline = 0;
+        _displayed_field_type = rhs._displayed_field_type;
+    }
+    return *this;
+}
+
+void field::copy_entries( const field &other )
+{
+    for( size_t i = 0; i < other.num_inline; ++i ) {
+        new( inline_entries() + i ) value_type( other.inline_entries()[i] );
+    }
+    num_inline = other.num_inline;
+    if( other.overflow ) {
+        overflow = std::make_unique<std::deque<value_type>>( *other.overflow );
+    } else {
+        overflow.reset();
+    }
+}
+
+field::value_type *field::find_entry( const field_type_id &type )
+{
+    for( size_t i = 0; i < num_inline; ++i ) {
+        if( inline_entries()[i].first == type ) {
+            return inline_entries() + i;
+        }
+    }
+    if( overflow ) {
+        for( value_type &e : *overflow ) {
+            if( e.first == type ) {
+                return &e;
+            }
+        }
+    }
+    return nullptr;
+}
+
 /*
 Function: find_field
 Returns a field entry corresponding to the field_type_id parameter passed in. If no fields are found then returns NULL.
@@ -128,9 +197,9 @@ field_entry *field::find_field( const field_type_id &field_type_to_find, const b
     if( !_displayed_field_type ) {
         return nullptr;
     }
-    const auto it = _field_type_list->find( field_type_to_find );
-    if( it != _field_type_list->end() && ( !alive_only || it->second.is_field_alive() ) ) {
-        return &it->second;
+    value_type *const e = find_entry( field_type_to_find );
+    if( e && ( !alive_only || e->second.is_field_alive() ) ) {
+        return &e->second;
     }
     return nullptr;
 }
@@ -138,14 +207,7 @@ field_entry *field::find_field( const field_type_id &field_type_to_find, const b
 const field_entry *field::find_field( const field_type_id &field_type_to_find,
                                       const bool alive_only ) const
 {
-    if( !_displayed_field_type ) {
-        return nullptr;
-    }
-    const auto it = _field_type_list->find( field_type_to_find );
-    if( it != _field_type_list->end() && ( !alive_only || it->second.is_field_alive() ) ) {
-        return &it->second;
-    }
-    return nullptr;
+    return const_cast<field *>( this )->find_field( field_type_to_find, alive_only );
 }
 
 /*
@@ -163,40 +225,74 @@ bool field::add_field( const field_type_id &field_type_to_add, const int new_int
     if( !field_type_to_add ) {
         return false;
     }
-    auto it = _field_type_list->find( field_type_to_add );
-    if( it != _field_type_list->end() ) {
+    if( value_type *const e = find_entry( field_type_to_add ) ) {
         //Already exists, but lets update it. This is tentative.
-        int prev_intensity = it->second.get_field_intensity();
-        if( !it->second.is_field_alive() ) {
-            it->second.set_field_age( new_age );
+        int prev_intensity = e->second.get_field_intensity();
+        if( !e->second.is_field_alive() ) {
+            e->second.set_field_age( new_age );
             prev_intensity = 0;
         }
-        it->second.set_field_intensity( prev_intensity + new_intensity );
+        e->second.set_field_intensity( prev_intensity + new_intensity );
         return false;
     }
     if( !_displayed_field_type ||
         field_type_to_add.obj().priority >= _displayed_field_type.obj().priority ) {
         _displayed_field_type = field_type_to_add;
     }
-    _field_type_list[field_type_to_add] = field_entry( field_type_to_add, new_intensity, new_age );
+    value_type added( field_type_to_add, field_entry( field_type_to_add, new_intensity, new_age ) );
+    if( num_inline < inline_fields ) {
+        new( inline_entries() + num_inline ) value_type( added );
+        ++num_inline;
+    } else {
+        if( !overflow ) {
+            overflow = std::make_unique<std::deque<value_type>>();
+        }
+        overflow->push_back( added );
+    }
     return true;
 }
 
 bool field::remove_field( const field_type_id &field_to_remove )
 {
-    const auto it = _field_type_list->find( field_to_remove );
-    if( it == _field_type_list->end() ) {
-        return false;
+    for( iterator it = begin(); it != end(); ++it ) {
+        if( it->first == field_to_remove ) {
+            remove_field( it );
+            return true;
+        }
     }
-    remove_field( it );
-    return true;
+    return false;
 }
 
-void field::remove_field( std::map<field_type_id, field_entry>::iterator const it )
+field::iterator field::remove_field( iterator it )
+{
+    const size_t i = it.i;
+    if( i < num_inline ) {
+        value_type *const entries = inline_entries();
+        std::move( entries + i + 1, entries + num_inline, entries + i );
+        if( overflow ) {
+            // Keep the inline entries full as long as there are others
+            entries[num_inline - 1] = overflow->front();
+            overflow->pop_front();
+        } else {
+            --num_inline;
+        }
+    } else {
+        // Not erase(), that may move the entries in front of the removed one instead
+        std::move( overflow->begin() + ( i - num_inline ) + 1, overflow->end(),
+                   overflow->begin() + ( i - num_inline ) );
+        overflow->pop_back();
+    }
+    if( overflow && overflow->empty() ) {
+        overflow.reset();
+    }
+    update_displayed_field_type();
+    return iterator( this, i );
+}
+
+void field::update_displayed_field_type()
 {
-    _field_type_list->erase( it );
     _displayed_field_type = fd_null;
-    for( auto &fld : *_field_type_list ) {
+    for( const value_type &fld : *this ) {
         if( !_displayed_field_type || fld.first.obj().priority >= _displayed_field_type.obj().priority ) {
             _displayed_field_type = fld.first;
         }
@@ -205,7 +301,8 @@ void field::remove_field( std::map<field_type_id, field_entry>::iterator const i
 
 void field::clear()
 {
-    _field_type_list->clear();
+    num_inline = 0;
+    overflow.reset();
     _displayed_field_type = fd_null;
 }
 
@@ -215,27 +312,7 @@ Returns the number of fields existing on the current tile.
 */
 unsigned int field::field_count() const
 {
-    return _field_type_list->size();
-}
-
-std::map<field_type_id, field_entry>::iterator field::begin()
-{
-    return _field_type_list->begin();
-}
-
-std::map<field_type_id, field_entry>::const_iterator field::begin() const
-{
-    return _field_type_list->begin();
-}
-
-std::map<field_type_id, field_entry>::iterator field::end()
-{
-    return _field_type_list->end();
-}
-
-std::map<field_type_id, field_entry>::const_iterator field::end() const
-{
-    return _field_type_list->end();
+    return num_inline + ( overflow ? overflow->size() : 0 );
 }
 
 /*
@@ -254,14 +331,13 @@ description_affix field::displayed_description_affix() const
 
 int field::displayed_intensity() const
 {
-    auto it = _field_type_list->find( _displayed_field_type );
-    return it->second.get_field_intensity();
+    return find_field( _displayed_field_type, false )->get_field_intensity();
 }
 
 int field::total_move_cost() const
 {
     int current_cost = 0;
-    for( const auto &fld : *_field_type_list ) {
+    for( const value_type &fld : *this ) {
         current_cost += fld.second.get_intensity_level().move_cost;
     }
     return current_cost;
@@ -269,7 +345,7 @@ int field::total_move_cost() const
 
 bool field::any_negative_move_cost() const
 {
-    for( const auto &fld : *_field_type_list ) {
+    for( const value_type &fld : *this ) {
         if( fld.second.get_intensity_level().move_cost < 0 ) {
             return true;
         }
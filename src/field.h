@@ -2,12 +2,18 @@
 #ifndef CATA_SRC_FIELD_H
 #define CATA_SRC_FIELD_H
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
-#include "cata_lazy.h"
 #include "color.h"
 #include "enums.h"
 #include "field_type.h"
@@ -106,7 +112,75 @@ class field_entry
 class field
 {
     public:
+        using value_type = std::pair<field_type_id, field_entry>;
+
+        /**
+         * Goes over the entries by position, in the order they were added (not by field
+         * type id). Entries added while iterating are visited too, and an iterator that
+         * ended up past the last entry (because some were removed) compares equal to end().
+         */
+        template<typename Field, typename Value>
+        class iterator_base
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = std::remove_const_t<Value>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Value *;
+                using reference = Value &;
+
+                iterator_base() = default;
+                iterator_base( Field *f, size_t i ) : f( f ), i( i ) {}
+                // iterator to const_iterator
+                template<typename OtherField, typename OtherValue,
+                         typename = std::enable_if_t<!std::is_same_v<Field, OtherField>>>
+                // NOLINTNEXTLINE(google-explicit-constructor)
+                iterator_base( const iterator_base<OtherField, OtherValue> &other ) :
+                    f( other.f ), i( other.i ) {}
+
+                reference operator*() const {
+                    return f->entry( i );
+                }
+                pointer operator->() const {
+                    return &f->entry( i );
+                }
+                iterator_base &operator++() {
+                    ++i;
+                    return *this;
+                }
+                iterator_base operator++( int ) {
+                    iterator_base old = *this;
+                    ++i;
+                    return old;
+                }
+                bool operator==( const iterator_base &rhs ) const {
+                    return f == rhs.f && ( i == rhs.i || ( at_end() && rhs.at_end() ) );
+                }
+                bool operator!=( const iterator_base &rhs ) const {
+                    return !( *this == rhs );
+                }
+
+            private:
+                bool at_end() const {
+                    return i >= f->field_count();
+                }
+
+                template<typename, typename>
+                friend class iterator_base;
+                friend class field;
+
+                Field *f = nullptr;
+                size_t i = 0;
+        };
+        using iterator = iterator_base<field, value_type>;
+        using const_iterator = iterator_base<const field, const value_type>;
+
         field();
+        field( const field &other );
+        field( field &&other ) noexcept;
+        field &operator=( const field &rhs );
+        field &operator=( field &&rhs ) noexcept;
+        ~field() = default;
 
         /**
          * Returns a field entry corresponding to the field_type_id parameter passed in.
@@ -136,14 +210,22 @@ class field
          * Removes the field entry with a type equal to the field_type_id parameter.
          * Make sure to decrement the field counter in the submap if (and only if) the
          * function returns true.
+         * Unlike adding, removing moves the entries after the removed one (see below).
          * @return True if the field was removed, false if it did not exist in the first place.
          */
         bool remove_field( const field_type_id &field_to_remove );
         /**
          * Make sure to decrement the field counter in the submap.
-         * Removes the field entry, the iterator must point into @ref _field_type_list and must be valid.
+         * Removes the field entry, the iterator must point to an entry of this field.
+         * The entries after it move up by one, so pointers and references to them are
+         * invalidated and iterators to them now point to the entry after. Entries before
+         * the removed one stay where they are. To remove while going over the field,
+         * continue from the returned iterator. Code that only needs a field gone (like
+         * map::remove_field) should set its intensity to 0 instead, it gets removed by the
+         * next map::process_fields.
+         * @return An iterator to the entry after the removed one.
          */
-        void remove_field( std::map<field_type_id, field_entry>::iterator );
+        iterator remove_field( iterator it );
 
         /**
          * Removes all fields.
@@ -166,13 +248,21 @@ class field
 
         description_affix displayed_description_affix() const;
 
-        //Returns the vector iterator to begin searching through the list.
-        std::map<field_type_id, field_entry>::iterator begin();
-        std::map<field_type_id, field_entry>::const_iterator begin() const;
+        //Returns the iterator to begin searching through the list.
+        iterator begin() {
+            return iterator( this, 0 );
+        }
+        const_iterator begin() const {
+            return const_iterator( this, 0 );
+        }
 
-        //Returns the vector iterator to end searching through the list.
-        std::map<field_type_id, field_entry>::iterator end();
-        std::map<field_type_id, field_entry>::const_iterator end() const;
+        //Returns the iterator to end searching through the list.
+        iterator end() {
+            return iterator( this, field_count() );
+        }
+        const_iterator end() const {
+            return const_iterator( this, field_count() );
+        }
 
         /**
          * Returns the total move cost from all fields.
@@ -183,8 +273,33 @@ class field
         bool any_negative_move_cost() const;
 
     private:
-        // A pointer lookup table of all field effects on the current tile.
-        lazy<std::map<field_type_id, field_entry>> _field_type_list;
+        value_type &entry( size_t i ) {
+            return i < num_inline ? inline_entries()[i] : ( *overflow )[i - num_inline];
+        }
+        const value_type &entry( size_t i ) const {
+            return i < num_inline ? inline_entries()[i] : ( *overflow )[i - num_inline];
+        }
+        value_type *inline_entries() {
+            return std::launder( reinterpret_cast<value_type *>( inline_storage ) );
+        }
+        const value_type *inline_entries() const {
+            return std::launder( reinterpret_cast<const value_type *>( inline_storage ) );
+        }
+        value_type *find_entry( const field_type_id &type );
+        void copy_entries( const field &other );
+        void update_displayed_field_type();
+
+        // Most tiles with fields have only one or two, those are kept right here instead
+        // of in a separate allocation. Entries must stay where they are while more get
+        // added: field processors hold on to the entry they're processing while adding
+        // fields to the same tile.
+        static constexpr size_t inline_fields = 2;
+        static_assert( std::is_trivially_destructible_v<value_type> );
+        alignas( value_type ) unsigned char inline_storage[inline_fields * sizeof( value_type )];
+        uint8_t num_inline = 0;
+        // Only used once the inline entries are full. A deque, so push_back keeps the
+        // others in place.
+        std::unique_ptr<std::deque<value_type>> overflow;
         //_displayed_field_type currently is equal to the last field added to the square. You can modify this behavior in the class functions if you wish.
         field_type_id _displayed_field_type;
 };
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
@@ -128,6 +129,11 @@ std::vector<uint8_t> parse_json_to_flexbuffer_(
     return std::move( fbb ).GetBuffer();
 }
 
+// Source files found to be newer than their cached flexbuffers, waiting for
+// flexbuffer_cache::report_stale_game_data.
+std::mutex stale_game_data_mutex;
+std::vector<std::string> stale_game_data_files;
+
 } // namespace
 
 struct flexbuffer_vector_storage : flexbuffer_storage {
@@ -306,6 +312,7 @@ class flexbuffer_disk_cache
         std::shared_ptr<flexbuffer_mmap_storage> load_flexbuffer_if_not_stale(
             const std::filesystem::path &lexically_normal_json_source_path ) {
             std::shared_ptr<flexbuffer_mmap_storage> storage;
+            std::lock_guard<std::mutex> lock( mutex_ );
 
             std::filesystem::path root_relative_source_path =
                 lexically_normal_json_source_path.lexically_relative(
@@ -332,14 +339,9 @@ class flexbuffer_disk_cache
                                        *root_relative_source_path.begin() != std::filesystem::u8path( "achievements" ) &&
                                        *root_relative_source_path.begin() != std::filesystem::u8path( "templates" );
                 if( stale_game_data ) {
-                    if( get_option<bool>( "WARN_ON_MODIFIED" ) ) {
-                        debugmsg( "Stale game data detected at %s, did you overwrite old files?  When updating the game you must install to a fresh folder, overwriting old files will cause errors.",
-                                  filepath_and_name );
-                    } else {
-                        // we still log the modification warning even if the option is disabled, for sifting bug reports
-                        DebugLog( D_WARNING, D_MAIN ) << "Stale game data detected (error disabled by user): " <<
-                                                      filepath_and_name;
-                    }
+                    // This may run on a worker thread, leave the reporting to the main thread
+                    std::lock_guard<std::mutex> stale_lock( stale_game_data_mutex );
+                    stale_game_data_files.push_back( filepath_and_name );
                 }
                 // Cached flexbuffer on disk is out of date, remove it.
                 remove_file( disk_entry->second.flexbuffer_path.u8string() );
@@ -393,6 +395,7 @@ class flexbuffer_disk_cache
             }
 
             fb.close();
+            std::lock_guard<std::mutex> lock( mutex_ );
             cached_flexbuffers_[json_source_path_string] = disk_cache_entry{ flexbuffer_path, mtime };
 
             return true;
@@ -412,6 +415,8 @@ class flexbuffer_disk_cache
         };
         // Maps game root relative json source path to the most recent cached flexbuffer we have on disk for it.
         std::unordered_map<std::string, disk_cache_entry> cached_flexbuffers_;
+        // Files may be parsed from several threads at once, see json_loader::from_paths_parallel.
+        std::mutex mutex_;
 };
 
 flexbuffer_cache::flexbuffer_cache( const std::filesystem::path &cache_directory,
@@ -424,6 +429,25 @@ flexbuffer_cache::flexbuffer_cache( const std::filesystem::path &cache_directory
 
 flexbuffer_cache::~flexbuffer_cache() = default;
 
+void flexbuffer_cache::report_stale_game_data()
+{
+    std::vector<std::string> stale_files;
+    {
+        std::lock_guard<std::mutex> lock( stale_game_data_mutex );
+        stale_files.swap( stale_game_data_files );
+    }
+    for( const std::string &filepath_and_name : stale_files ) {
+        if( get_option<bool>( "WARN_ON_MODIFIED" ) ) {
+            debugmsg( "Stale game data detected at %s, did you overwrite old files?  When updating the game you must install to a fresh folder, overwriting old files will cause errors.",
+                      filepath_and_name );
+        } else {
+            // we still log the modification warning even if the option is disabled, for sifting bug reports
+            DebugLog( D_WARNING, D_MAIN ) << "Stale game data detected (error disabled by user): " <<
+                                          filepath_and_name;
+        }
+    }
+}
+
 std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse( std::filesystem::path json_source_path,
         size_t offset )
 {
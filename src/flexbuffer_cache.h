@@ -64,6 +64,10 @@ class flexbuffer_cache
 
         static shared_flexbuffer parse_buffer( std::string buffer ) noexcept( false );
 
+        // Warns about cached flexbuffers that were found out of date while parsing.
+        // Parsing may happen on worker threads, so this has to be called from the main thread.
+        static void report_stale_game_data();
+
     private:
         flexbuffer_cache( flexbuffer_cache && ) noexcept = default;
 
@@ -169,6 +169,7 @@
 #include "past_achievements_info.h"
 #include "path_info.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "pickup.h"
 #include "player_activity.h"
 #include "popup.h"
@@ -4144,6 +4145,7 @@ bool game::has_blink_curses()
 
 void game::draw( ui_adaptor &ui )
 {
+    turn_profile_scope profile( "draw" );
     map &here = get_map();
 
     if( test_mode ) {
@@ -4500,7 +4502,7 @@ Creature *game::is_hostile_within( int distance, bool dangerous )
 field_entry *game::is_in_dangerous_field()
 {
     map &here = get_map();
-    for( std::pair<const field_type_id, field_entry> &field : here.field_at( u.pos_bub() ) ) {
+    for( std::pair<field_type_id, field_entry> &field : here.field_at( u.pos_bub() ) ) {
         if( u.is_dangerous_field( field.second ) ) {
             if( u.in_vehicle ) {
                 bool not_safe = false;
@@ -10514,7 +10516,7 @@ std::vector<std::string> game::get_dangerous_tile( const tripoint_bub_ms &dest_l
     const bool veh_here_inside = veh_here && veh_here->is_inside();
     const bool veh_dest_inside = veh_dest && veh_dest->is_inside();
 
-    for( const std::pair<const field_type_id, field_entry> &e : here.field_at( dest_loc ) ) {
+    for( const std::pair<field_type_id, field_entry> &e : here.field_at( dest_loc ) ) {
         if( !u.is_dangerous_field( e.second ) ) {
             continue;
         }
@@ -13143,6 +13145,16 @@ point_rel_sm game::update_map( int &x, int &y, bool z_level_changed )
     // Put those in the active list.
     load_npcs();
 
+    // Read ahead the submaps the next shifts will need. A moving vehicle can cross
+    // more than one submap per turn, so look further ahead the faster it goes.
+    int prefetch_lookahead = 1;
+    if( const optional_vpart_position vp = here.veh_at( u.pos_bub() ) ) {
+        const float submaps_per_turn =
+            std::abs( vp->vehicle().velocity ) / vehicles::vmiph_per_tile / SEEX;
+        prefetch_lookahead = std::clamp( 1 + static_cast<int>( submaps_per_turn ), 1, 3 );
+    }
+    here.prefetch_submaps( point_rel_sm( clamp( shift, size_1 ) ), prefetch_lookahead );
+
     // Make sure map cache is consistent since it may have shifted.
     for( int zlev = -OVERMAP_DEPTH; zlev <= OVERMAP_HEIGHT; ++zlev ) {
         here.invalidate_map_cache( zlev );
@@ -14121,7 +14133,7 @@ void game::climb_down_using( const tripoint_bub_ms &examp, climbing_aid_id aid_i
     }
 
     if( here.dangerous_field_at( fall.pos_bottom() ) ) {
-        for( const std::pair<const field_type_id, field_entry> &danger_field : here.field_at(
+        for( const std::pair<field_type_id, field_entry> &danger_field : here.field_at(
                  fall.pos_bottom() ) ) {
             if( danger_field.first->is_dangerous() ) {
                 query += "\n";
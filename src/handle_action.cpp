@@ -76,6 +76,7 @@
 #include "overmap_ui.h"
 #include "panels.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "player_activity.h"
 #include "point.h"
 #include "popup.h"
@@ -1008,7 +1009,7 @@ avatar::smash_result avatar::smash( tripoint_bub_ms &smashp )
             crit->use_mech_power( 3_kJ );
         }
     }
-    for( std::pair<const field_type_id, field_entry> &fd_to_smsh : here.field_at( smashp ) ) {
+    for( std::pair<field_type_id, field_entry> &fd_to_smsh : here.field_at( smashp ) ) {
         const std::optional<map_fd_bash_info> &bash_info = fd_to_smsh.first->bash_info;
         if( !bash_info ) {
             continue;
@@ -3301,6 +3302,8 @@ bool game::handle_action()
     gamemode->pre_action( act );
 
     int before_action_moves = player_character.get_moves();
+    // Starts after the input is read, but actions that open a menu still count the time spent in it
+    turn_profile_scope profile( "player_action" );
 
     // These actions are allowed while deathcam is active. Registered in game::get_player_input
     if( uquit == QUIT_WATCH || !player_character.is_dead_state() ) {
@@ -1,13 +1,17 @@
 #include "init.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "achievement.h"
@@ -112,6 +116,7 @@
 #include "subbodypart.h"
 #include "test_data.h"
 #include "text_snippets.h"
+#include "thread_pool.h"
 #include "translations.h"
 #include "trap.h"
 #include "type_id.h"
@@ -206,6 +211,50 @@ void DynamicDataLoader::load_deferred( deferred_json &data )
     }
 }
 
+// Reads and parses the files a batch at a time on the thread pool, then hands them to
+// load one by one in their original order, so types get registered exactly as if the
+// files had been loaded serially.
+static void load_files_in_order( const std::vector<cata_path> &files,
+                                 const std::function<void( size_t, const JsonValue & )> &load )
+{
+    const size_t batch_size = 4 * ( get_thread_pool().num_workers() + 1 );
+    for( size_t first = 0; first < files.size(); first += batch_size ) {
+        const size_t last = std::min( first + batch_size, files.size() );
+        std::vector<std::optional<JsonValue>> parsed = json_loader::from_paths_parallel(
+                    std::vector<cata_path>( files.begin() + first, files.begin() + last ) );
+        for( size_t i = first; i < last; ++i ) {
+            try {
+                // Files that failed to parse are parsed again here to throw the error
+                std::optional<JsonValue> &jsin = parsed[i - first];
+                load( i, jsin ? std::move( *jsin ) : json_loader::from_path( files[i] ) );
+            } catch( const JsonError &err ) {
+                throw std::runtime_error( err.what() );
+            }
+        }
+    }
+}
+
+using named_step = std::pair<std::string, std::function<void()>>;
+
+// Runs each of the steps, showing them on the loading screen and logging how long they took
+static void run_timed_steps( const std::string &context, const std::vector<named_step> &steps )
+{
+    using clock = std::chrono::steady_clock;
+    const auto ms_since = []( const clock::time_point & since ) {
+        using std::chrono::milliseconds;
+        return std::chrono::duration_cast<milliseconds>( clock::now() - since ).count();
+    };
+    const clock::time_point start = clock::now();
+    for( const named_step &step : steps ) {
+        loading_ui::show( context, step.first );
+        const clock::time_point step_start = clock::now();
+        step.second();
+        DebugLog( D_INFO, DC_ALL ) << context << " " << step.first << ": " <<
+                                   ms_since( step_start ) << " ms";
+    }
+    DebugLog( D_INFO, DC_ALL ) << context << " total: " << ms_since( start ) << " ms";
+}
+
 static void load_ignored_type( const JsonObject &jo )
 {
     // This does nothing!
@@ -490,16 +539,9 @@ void DynamicDataLoader::load_data_from_path( const cata_path &path, const std::s
         files.emplace_back( path );
     }
 
-    // iterate over each file
-    for( const cata_path &file : files ) {
-        try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file );
-            load_all_from_json( jsin, src, path, file );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
-        }
-    }
+    load_files_in_order( files, [&]( size_t i, const JsonValue & jsin ) {
+        load_all_from_json( jsin, src, path, files[i] );
+    } );
 }
 
 void DynamicDataLoader::load_mod_data_from_path( const cata_path &path, const std::string &src )
@@ -523,16 +565,9 @@ void DynamicDataLoader::load_mod_data_from_path( const cata_path &path, const st
         files.emplace_back( path );
     }
 
-    // iterate over each file
-    for( const cata_path &file : files ) {
-        try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file );
-            load_all_from_json( jsin, src, path, file );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
-        }
-    }
+    load_files_in_order( files, [&]( size_t i, const JsonValue & jsin ) {
+        load_all_from_json( jsin, src, path, files[i] );
+    } );
 }
 
 void DynamicDataLoader::load_mod_interaction_files_from_path( const cata_path &path,
@@ -562,16 +597,16 @@ void DynamicDataLoader::load_mod_interaction_files_from_path( const cata_path &p
             }
         }
     }
-    // iterate over each file
+    std::vector<mod_id> file_mods;
+    std::vector<cata_path> file_paths;
     for( const std::pair<const mod_id, cata_path> &file : files ) {
-        try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file.second );
-            load_all_from_json( jsin, string_format( "%s#%s", src, file.first.str() ), path, file.second );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
-        }
+        file_mods.push_back( file.first );
+        file_paths.push_back( file.second );
     }
+    load_files_in_order( file_paths, [&]( size_t i, const JsonValue & jsin ) {
+        load_all_from_json( jsin, string_format( "%s#%s", src, file_mods[i].str() ), path,
+                            file_paths[i] );
+    } );
 }
 
 void DynamicDataLoader::load_all_from_json( const JsonValue &jsin, const std::string &src,
@@ -738,8 +773,7 @@ void DynamicDataLoader::finalize_loaded_data()
     } );
     stream_cache = std::make_unique<cached_streams>();
 
-    using named_entry = std::pair<std::string, std::function<void()>>;
-    const std::vector<named_entry> entries = {{
+    const std::vector<named_step> entries = {{
             { _( "Flags" ), &json_flag::finalize_all },
             { _( "Option sliders" ), &option_slider::finalize_all },
             { _( "Body parts" ), &body_part_type::finalize_all },
@@ -811,10 +845,7 @@ void DynamicDataLoader::finalize_loaded_data()
         }
     };
 
-    for( const named_entry &e : entries ) {
-        loading_ui::show( _( "Finalizing" ), e.first );
-        e.second();
-    }
+    run_timed_steps( _( "Finalizing" ), entries );
 
     if( !get_option<bool>( "SKIP_VERIFICATION" ) ) {
         check_consistency();
@@ -824,8 +855,7 @@ void DynamicDataLoader::finalize_loaded_data()
 
 void DynamicDataLoader::check_consistency()
 {
-    using named_entry = std::pair<std::string, std::function<void()>>;
-    const std::vector<named_entry> entries = {{
+    const std::vector<named_step> entries = {{
             { _( "Flags" ), &json_flag::check_consistency },
             { _( "Option sliders" ), &option_slider::check_consistency },
             {
@@ -912,8 +942,5 @@ void DynamicDataLoader::check_consistency()
         }
     };
 
-    for( const named_entry &e : entries ) {
-        loading_ui::show( _( "Verifying" ), e.first );
-        e.second();
-    }
+    run_timed_steps( _( "Verifying" ), entries );
 }
@@ -1109,18 +1109,25 @@ const itype_bin &inventory::get_binned_items() const
     }
 
     binned_items.clear();
+    binned_rotten = false;
+    binned_favorite = false;
+    const auto bin = [this]( const item * it ) {
+        binned_items[it->typeId()].push_back( it );
+        binned_rotten = binned_rotten || it->rotten();
+        binned_favorite = binned_favorite || it->is_favorite;
+    };
 
     // HACK: Hack warning
     inventory *this_nonconst = const_cast<inventory *>( this );
-    this_nonconst->visit_items( [ this ]( item * e, item * ) {
-        binned_items[ e->typeId() ].push_back( e );
+    this_nonconst->visit_items( [ &bin ]( item * e, item * ) {
+        bin( e );
         for( const item *it : e->softwares() ) {
-            binned_items[it->typeId()].push_back( it );
+            bin( it );
         }
         // list stored ebooks
         if( e->is_estorage() && !e->is_broken_on_active() ) {
             for( const item *book : e->get_contents().ebooks() ) {
-                binned_items[ book->typeId() ].push_back( book );
+                bin( book );
             }
         }
         return VisitResponse::NEXT;
@@ -1130,6 +1137,18 @@ const itype_bin &inventory::get_binned_items() const
     return binned_items;
 }
 
+bool inventory::has_rotten_items() const
+{
+    get_binned_items();
+    return binned_rotten;
+}
+
+bool inventory::has_favorite_items() const
+{
+    get_binned_items();
+    return binned_favorite;
+}
+
 void inventory::copy_invlet_of( const inventory &other )
 {
     assigned_invlet = other.assigned_invlet;
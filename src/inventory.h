@@ -247,6 +247,13 @@ class inventory : public visitable
          */
         const itype_bin &get_binned_items() const;
 
+        /**
+         * Whether any of the binned items is rotten, or favorited, as of when they were binned.
+         * Filters that only reject such items can't make a difference otherwise.
+         */
+        bool has_rotten_items() const;
+        bool has_favorite_items() const;
+
         void update_cache_with_item( item &newit );
 
         void copy_invlet_of( const inventory &other );
@@ -296,6 +303,8 @@ class inventory : public visitable
          * `mutable` because this is a pure cache that doesn't affect the contained items.
          */
         mutable itype_bin binned_items;
+        mutable bool binned_rotten = false;
+        mutable bool binned_favorite = false;
 
         mutable std::map<quality_query, bool> qualities_cache;
 };
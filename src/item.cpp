@@ -411,7 +411,10 @@ item::item( const itype *type, time_point turn, int qty ) : type( type ), bday(
     }
 
     if( !type->snippet_category.empty() ) {
-        snip_id = SNIPPET.random_id_from_category( type->snippet_category );
+        const snippet_id snip = SNIPPET.random_id_from_category( type->snippet_category );
+        if( !snip.is_null() ) {
+            get_rare_data_for_writing().snip_id = snip;
+        }
     }
 
     if( type->expand_snippets ) {
@@ -650,9 +653,9 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
         result.set_var( "zombie_form", mt->zombify_into.c_str() );
     }
 
-    // This is unconditional because the const itemructor above sets result.name to
-    // "human corpse".
-    result.corpse_name = name;
+    if( !name.empty() ) {
+        result.get_rare_data_for_writing().corpse_name = name;
+    }
 
     return result;
 }
@@ -1787,7 +1790,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CORPSE,
               ( corpse == nullptr && rhs.corpse == nullptr ) ||
               ( corpse != nullptr && rhs.corpse != nullptr && corpse->id == rhs.corpse->id &&
-                corpse_name == rhs.corpse_name ) );
+                get_rare_data().corpse_name == rhs.get_rare_data().corpse_name ) );
     bits.set( tname::segments::FOOD_PERISHABLE, _stacks_food_perishable( *this, rhs, check_cat ) );
     bits.set( tname::segments::CLOTHING_SIZE, _stacks_clothing_size( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
@@ -2426,15 +2429,16 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         insert_separation_line( info );
         global_variables::impl_t::const_iterator const idescription =
             item_vars.find( "description" );
-        const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
+        const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( get_snippet() );
         if( snippet.has_value() ) {
             // Just use the dynamic description
             info.emplace_back( "DESCRIPTION", snippet.value().translated() );
 
             // only ever do the effect for a snippet the first time you see it
-            if( !get_avatar().has_seen_snippet( snip_id ) ) {
+            if( !get_avatar().has_seen_snippet( get_snippet() ) ) {
                 // Have looked at the item so call the on examine EOC for the snippet
-                const std::optional<talk_effect_t> examine_effect = SNIPPET.get_EOC_by_id( snip_id );
+                const std::optional<talk_effect_t> examine_effect =
+                    SNIPPET.get_EOC_by_id( get_snippet() );
                 if( examine_effect.has_value() ) {
                     // activate the effect
                     dialogue d( get_talker_for( get_avatar() ), nullptr );
@@ -2442,7 +2446,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
                 }
 
                 //note that you have seen the snippet
-                get_avatar().add_snippet( snip_id );
+                get_avatar().add_snippet( get_snippet() );
             }
         } else if( idescription != item_vars.end() ) {
             info.emplace_back( "DESCRIPTION", idescription->second.str() );
@@ -7812,7 +7816,7 @@ std::string item::get_fault_description( const fault_id &f_id ) const
     return string_format( f_id.obj().description(), type->nname( 1 ) );
 }
 
-bool item::can_have_fault( const fault_id &f_id )
+bool item::can_have_fault( const fault_id &f_id ) const
 {
     // f_id fault is not defined in itype
     if( type->faults.get_specific_weight( f_id ) == 0 ) {
@@ -13227,11 +13231,74 @@ void item::set_snippet( const snippet_id &id )
     if( is_null() ) {
         return;
     }
-    if( !id.is_valid() ) {
+    if( !id.is_null() && !id.is_valid() ) {
         debugmsg( "there's no snippet with id %s", id.str() );
         return;
     }
-    snip_id = id;
+    if( rare_data_ || !id.is_null() ) {
+        get_rare_data_for_writing().snip_id = id;
+    }
+}
+
+const snippet_id &item::get_snippet() const
+{
+    return get_rare_data().snip_id;
+}
+
+int item::get_frequency() const
+{
+    return get_rare_data().frequency;
+}
+
+void item::set_frequency( int frequency )
+{
+    if( rare_data_ || frequency != 0 ) {
+        get_rare_data_for_writing().frequency = frequency;
+    }
+}
+
+int item::get_mission_id() const
+{
+    return get_rare_data().mission_id;
+}
+
+void item::set_mission_id( int mission_id )
+{
+    if( rare_data_ || mission_id != -1 ) {
+        get_rare_data_for_writing().mission_id = mission_id;
+    }
+}
+
+const harvest_drop_type_id &item::get_dropped_from() const
+{
+    return get_rare_data().dropped_from;
+}
+
+void item::set_dropped_from( const harvest_drop_type_id &dropped_from )
+{
+    if( rare_data_ || !dropped_from.is_null() ) {
+        get_rare_data_for_writing().dropped_from = dropped_from;
+    }
+}
+
+bool item::rare_data::is_empty() const
+{
+    return corpse_name.empty() && snip_id.is_null() && dropped_from.is_null() && frequency == 0 &&
+           mission_id == -1 && player_id == -1;
+}
+
+const item::rare_data &item::get_rare_data() const
+{
+    static const rare_data defaults;
+    return rare_data_ ? *rare_data_ : defaults;
+}
+
+item::rare_data &item::get_rare_data_for_writing()
+{
+    if( !rare_data_ ) {
+        rare_data_ = cata::make_value<rare_data>();
+    }
+    return *rare_data_;
 }
 
 const item_category &item::get_category_shallow() const
@@ -15469,14 +15536,14 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
 
     // Identify who this corpse belonged to, if applicable.
     if( corpse != nullptr && use_corpse && has_flag( flag_CORPSE ) ) {
-        if( corpse_name.empty() ) {
+        if( get_rare_data().corpse_name.empty() ) {
             //~ %1$s: name of corpse with modifiers;  %2$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of a %2$s" ),
                                       ret_name, corpse->nname() );
         } else {
             //~ %1$s: name of corpse with modifiers;  %2$s: proper name;  %3$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of %2$s, %3$s" ),
-                                      ret_name, corpse_name, corpse->nname() );
+                                      ret_name, get_rare_data().corpse_name, corpse->nname() );
         }
     }
 
@@ -15490,7 +15557,7 @@ const mtype *item::get_corpse_mon() const
 
 std::string item::get_corpse_name() const
 {
-    return corpse_name;
+    return get_rare_data().corpse_name;
 }
 
 std::string item::nname( const itype_id &id, unsigned int quantity )
@@ -1864,9 +1864,22 @@ class item : public visitable
 
         /**
          * Set the snippet text (description) of this specific item, using the snippet library.
+         * The null id removes the snippet.
          * @see snippet_library.
          */
         void set_snippet( const snippet_id &id );
+        /** Associated dynamic text snippet id, null if there is none. */
+        const snippet_id &get_snippet() const;
+
+        /** Radio frequency the item is tuned to. */
+        int get_frequency() const;
+        void set_frequency( int frequency );
+        /** Refers to a mission in game's master list, -1 if there is none. */
+        int get_mission_id() const;
+        void set_mission_id( int mission_id );
+        /** The harvest drop type this item spawned from. */
+        const harvest_drop_type_id &get_dropped_from() const;
+        void set_dropped_from( const harvest_drop_type_id &dropped_from );
 
         bool operator<( const item &other ) const;
         /**
@@ -2084,7 +2097,7 @@ class item : public visitable
         void remove_single_fault_of_type( const std::string &fault_type );
 
         // Check if adding this fault is possible
-        bool can_have_fault( const fault_id &f_id );
+        bool can_have_fault( const fault_id &f_id ) const;
 
         /** Idempotent filter removing an item specific flag */
         item &unset_flag( const flag_id &flag );
@@ -3274,11 +3287,6 @@ class item : public visitable
 
     private:
         item_contents contents;
-        /**
-         * `true` if item has any of the flags that require processing in item::process_internal.
-         * This flag is reset to `true` if item tags are changed.
-         */
-        bool requires_tags_processing = true;
         cata::heap<FlagsSetType> item_tags; // generic item specific flags
         cata::heap<FlagsSetType> inherited_tags_cache;
         cata::heap<FlagsSetType> prefix_tags_cache; // flags that will add prefixes to this item
@@ -3286,7 +3294,6 @@ class item : public visitable
         lazy<safe_reference_anchor> anchor;
         cata::heap<global_variables::impl_t> item_vars;
         const mtype *corpse = nullptr;
-        std::string corpse_name;       // Name of the late lamented
         cata::heap<std::set<matec_id>> techniques; // item specific techniques
 
         /**
@@ -3326,17 +3333,37 @@ class item : public visitable
         };
 
         cata::value_ptr<craft_data> craft_data_;
+
+        /**
+         * Members that only a few items ever set. They live behind a pointer that stays
+         * null until one of them is given a non-default value, which keeps item small.
+         */
+        struct rare_data {
+            std::string corpse_name;   // Name of the late lamented
+            snippet_id snip_id = snippet_id::NULL_ID(); // Associated dynamic text snippet id.
+            harvest_drop_type_id dropped_from =
+                harvest_drop_type_id::NULL_ID(); // The drop type this item spawned from
+            int frequency = 0;         // Radio frequency
+            int mission_id = -1;       // Refers to a mission in game's master list
+            int player_id = -1;        // Only give a mission to the right player!
+
+            /** Whether all members have their default values. */
+            bool is_empty() const;
+        };
+
+        cata::value_ptr<rare_data> rare_data_;
+
+        const rare_data &get_rare_data() const;
+        rare_data &get_rare_data_for_writing();
     public:
         // any relic data specific to this item
         cata::value_ptr<relic> relic_data;
-        int charges = 0;
         units::energy energy = 0_mJ; // Amount of energy currently stored in a battery
+        int charges = 0;
 
         int recipe_charges = 1;    // The number of charges a recipe creates.
         int burnt = 0;             // How badly we're burnt
         int poison = 0;            // How badly poisoned is it?
-        int frequency = 0;         // Radio frequency
-        snippet_id snip_id = snippet_id::NULL_ID(); // Associated dynamic text snippet id.
         int irradiation = 0;       // Tracks radiation dosage.
         int item_counter = 0;      // generic counter to be used with item flags
 
@@ -3346,23 +3373,10 @@ class item : public visitable
         units::specific_energy specific_energy = units::from_joule_per_gram(
                     -10 ); // Specific energy J/g. Negative value for unprocessed.
         units::temperature temperature = units::from_kelvin( 0 );       // Temperature of the item .
-        int mission_id = -1;       // Refers to a mission in game's master list
-        int player_id = -1;        // Only give a mission to the right player!
-        bool ethereal = false;
         int wetness = 0;           // Turns until this item is completely dry.
 
         int seed = rng( 0, INT_MAX );  // A random seed for layering and other options
 
-        harvest_drop_type_id dropped_from =
-            harvest_drop_type_id::NULL_ID(); // The drop type this item spawned from
-
-        /**
-         * Set when the item / its content changes. Used for worn item with
-         * encumbrance depending on their content.
-         * This part is not serialized or compared on purpose!
-         */
-        bool encumbrance_update_ = false;
-
         item_contents &get_contents() {
             return contents;
         };
@@ -3382,13 +3396,6 @@ class item : public visitable
         time_point last_temp_check = calendar::turn_zero;
         /// The time the item was created.
         time_point bday;
-        /**
-         * Current phase state, inherits a default at room temperature from
-         * itype and can be changed through item processing.  This is a static
-         * cast to avoid importing the entire enums.h header here, zero is
-         * PNULL.
-         */
-        phase_id current_phase = static_cast<phase_id>( 0 );
         /** The faction that owns this item. */
         mutable faction_id owner = faction_id::NULL_ID();
         /** The faction that previously owned this item. */
@@ -3405,15 +3412,37 @@ class item : public visitable
         };
         mutable cat_cache cached_category;
 
-        /** Is this item electronically browsed? */
-        bool browsed;
         /** Additional encumbrance this item, not itype, has. */
         units::volume additional_encumbrance = 0_ml;
 
+        // The small members are kept together at the end, so they share the padding
+
+        /**
+         * Current phase state, inherits a default at room temperature from
+         * itype and can be changed through item processing.  This is a static
+         * cast to avoid importing the entire enums.h header here, zero is
+         * PNULL.
+         */
+        phase_id current_phase = static_cast<phase_id>( 0 );
+        /** Is this item electronically browsed? */
+        bool browsed;
+        /**
+         * `true` if item has any of the flags that require processing in item::process_internal.
+         * This flag is reset to `true` if item tags are changed.
+         */
+        bool requires_tags_processing = true;
+
     public:
         char invlet = 0;      // Inventory letter
         bool active = false; // If true, it has active effects to be processed
         bool is_favorite = false;
+        bool ethereal = false;
+        /**
+         * Set when the item / its content changes. Used for worn item with
+         * encumbrance depending on their content.
+         * This part is not serialized or compared on purpose!
+         */
+        bool encumbrance_update_ = false;
 
         void set_favorite( bool favorite );
         bool has_clothing_mod() const;
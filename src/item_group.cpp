@@ -728,7 +728,7 @@ void Item_modifier::modify( item &new_item, const std::string &context ) const
     }
 
     if( !snippets.empty() ) {
-        new_item.snip_id = random_entry( snippets );
+        new_item.set_snippet( random_entry( snippets ) );
     }
 }
 
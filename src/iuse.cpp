@@ -2611,7 +2611,7 @@ std::optional<int> iuse::directional_antenna( Character *p, item *, const tripoi
     }
     const item radio = *radios.front();
     // Find the radio station it's tuned to (if any)
-    const radio_tower_reference tref = overmap_buffer.find_radio_station( radio.frequency );
+    const radio_tower_reference tref = overmap_buffer.find_radio_station( radio.get_frequency() );
     if( !tref ) {
         p->add_msg_if_player( m_info, _( "You can't find the direction if your radio isn't tuned." ) );
         return std::nullopt;
@@ -2650,8 +2650,8 @@ static int radio_static_chance( const radio_tower_reference &tref )
 std::optional<int> iuse::radio_tick( Character *, item *it, const tripoint_bub_ms &pos )
 {
     std::string message = _( "Radio: Kssssssssssssh." );
-    const radio_tower_reference tref = overmap_buffer.find_radio_station( it->frequency );
-    add_msg_debug( debugmode::DF_RADIO, "Set freq: %d", it->frequency );
+    const radio_tower_reference tref = overmap_buffer.find_radio_station( it->get_frequency() );
+    add_msg_debug( debugmode::DF_RADIO, "Set freq: %d", it->get_frequency() );
     if( tref ) {
         point_abs_omt dbgpos = project_to<coords::omt>( tref.abs_sm_pos );
         add_msg_debug( debugmode::DF_RADIO, "found broadcast (str %d) at (%d %d)",
@@ -2730,7 +2730,7 @@ std::optional<int> iuse::radio_on( Character *, item *it, const tripoint_bub_ms
     for( size_t i = 0; i < options.size(); ++i ) {
         std::string selected_text;
         const radio_tower_reference &tref = options[i];
-        if( it->frequency == tref.tower->frequency ) {
+        if( it->get_frequency() == tref.tower->frequency ) {
             selected_text = pgettext( "radio station", " (selected)" );
         }
         //~ Selected radio station, %d is a number in sequence (1,2,3...),
@@ -2745,7 +2745,7 @@ std::optional<int> iuse::radio_on( Character *, item *it, const tripoint_bub_ms
     scanlist.query();
     const int sel = scanlist.ret;
     if( sel >= 0 && static_cast<size_t>( sel ) < options.size() ) {
-        it->frequency = options[sel].tower->frequency;
+        it->set_frequency( options[sel].tower->frequency );
     }
     return 1;
 }
@@ -2,12 +2,14 @@
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "filesystem.h"
 #include "flexbuffer_cache.h"
 #include "flexbuffer_json.h"
 #include "path_info.h"
+#include "thread_pool.h"
 
 namespace
 {
@@ -42,6 +44,7 @@ flexbuffer_cache &user_cache()
 }
 
 std::unordered_map<std::string, std::unique_ptr<flexbuffer_cache>> save_caches;
+std::mutex save_caches_mutex;
 
 // There's no measurable need to persist flatbuffers for save data, so just create a per-world 'cache' which parses
 // but doesn't disk-cache the parsed flatbuffer.
@@ -57,6 +60,7 @@ flexbuffer_cache &cache_for_save( const cata_path &path )
     std::string folder_or_file = path_it->u8string();
     ++path_it;
 
+    std::lock_guard<std::mutex> lock( save_caches_mutex );
     auto it = save_caches.find( worldname_str );
     if( it == save_caches.end() ) {
         it = save_caches.emplace( worldname_str,
@@ -120,7 +124,9 @@ std::optional<JsonValue> json_loader::from_path_at_offset_opt( const cata_path &
     if( !file_exist( source_file.get_unrelative_path() ) ) {
         return std::nullopt;
     }
-    return from_path_at_offset_opt_impl( source_file, offset );
+    std::optional<JsonValue> obj = from_path_at_offset_opt_impl( source_file, offset );
+    flexbuffer_cache::report_stale_game_data();
+    return obj;
 }
 
 std::optional<JsonValue> json_loader::from_path_opt( const cata_path &source_file ) noexcept(
@@ -137,6 +143,7 @@ JsonValue json_loader::from_path_at_offset( const cata_path &source_file,
         throw JsonError( unrelative_path.generic_u8string() + " does not exist." );
     }
     auto obj = from_path_at_offset_opt_impl( source_file, offset );
+    flexbuffer_cache::report_stale_game_data();
 
     if( !obj ) {
         throw JsonError( "Json file " + unrelative_path.generic_u8string() +
@@ -150,6 +157,24 @@ JsonValue json_loader::from_path( const cata_path &source_file ) noexcept( false
     return from_path_at_offset( source_file, 0 );
 }
 
+std::vector<std::optional<JsonValue>> json_loader::from_paths_parallel(
+                                      const std::vector<cata_path> &source_files )
+{
+    std::vector<std::optional<JsonValue>> parsed( source_files.size() );
+    get_thread_pool().run_parallel( source_files.size(), [&]( size_t i ) {
+        try {
+            if( file_exist( source_files[i].get_unrelative_path() ) ) {
+                parsed[i] = from_path_at_offset_opt_impl( source_files[i], 0 );
+            }
+        } catch( ... ) {
+            // The error gets reported when the caller parses the file again
+            parsed[i].reset();
+        }
+    } );
+    flexbuffer_cache::report_stale_game_data();
+    return parsed;
+}
+
 JsonValue json_loader::from_string( std::string data ) noexcept( false )
 {
     std::shared_ptr<parsed_flexbuffer> buffer = flexbuffer_cache::parse_buffer( std::move( data ) );
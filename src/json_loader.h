@@ -2,6 +2,9 @@
 #ifndef CATA_SRC_JSON_LOADER_H
 #define CATA_SRC_JSON_LOADER_H
 
+#include <optional>
+#include <vector>
+
 #include "path_info.h"
 #include "flexbuffer_json.h"
 
@@ -20,6 +23,12 @@ class json_loader
         static std::optional<JsonValue> from_path_at_offset_opt( const cata_path &source_file,
                 size_t offset = 0 ) noexcept( false );
 
+        // Parses all of the given files at once, spreading them over the thread pool.
+        // Files that could not be read or parsed are left empty, load those again with
+        // json_loader::from_path on the calling thread to get the error.
+        static std::vector<std::optional<JsonValue>> from_paths_parallel(
+                    const std::vector<cata_path> &source_files );
+
         // Like json_loader::from_path, except instead of parsing data from a file, will parse data from a string in memory.
         static JsonValue from_string( std::string data ) noexcept( false );
         static std::optional<JsonValue> from_string_opt( std::string const &data ) noexcept( false );
@@ -11,12 +11,15 @@ level_cache::level_cache()
     transparency_cache_dirty.set();
     outside_cache_dirty = true;
     floor_cache_dirty = false;
+    scent_cache_dirty = true;
     constexpr four_quadrants four_zeros( 0.0f );
     std::fill_n( &lm[0][0], map_dimensions, four_zeros );
     std::fill_n( &sm[0][0], map_dimensions, 0.0f );
     std::fill_n( &light_source_buffer[0][0], map_dimensions, 0.0f );
     std::fill_n( &outside_cache[0][0], map_dimensions, false );
     std::fill_n( &floor_cache[0][0], map_dimensions, false );
+    std::fill_n( &scent_blocked_cache[0][0], map_dimensions, false );
+    std::fill_n( &scent_reduced_cache[0][0], map_dimensions, false );
     std::fill_n( &transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &vision_transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
@@ -27,6 +27,7 @@ struct level_cache {
         bool outside_cache_dirty = false;
         bool floor_cache_dirty = false;
         bool seen_cache_dirty = false;
+        bool scent_cache_dirty = false;
         // This is a single value indicating that the entire level is floored.
         bool no_floor_gaps = false;
 
@@ -49,6 +50,12 @@ struct level_cache {
         // i.e. true == has floor
         cata::mdarray<bool, point_bub_ms> floor_cache;
 
+        // terrain and furniture flags read by the scent diffusion, see map::scent_blockers
+        // true where ter_furn_flag::TFLAG_NO_SCENT stops scent entirely
+        cata::mdarray<bool, point_bub_ms> scent_blocked_cache;
+        // true where ter_furn_flag::TFLAG_REDUCE_SCENT lets only some scent through
+        cata::mdarray<bool, point_bub_ms> scent_reduced_cache;
+
         // stores cached transparency of the tiles
         // units: "transparency" (see LIGHT_TRANSPARENCY_OPEN_AIR)
         cata::mdarray<float, point_bub_ms>transparency_cache;
@@ -34,6 +34,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npc.h"
+#include "perf.h"
 #include "point.h"
 #include "string_formatter.h"
 #include "submap.h"
@@ -442,6 +443,7 @@ void map::build_sunlight_cache( int pzlev )
 
 void map::generate_lightmap( const int zlev )
 {
+    turn_profile_scope profile( "lightmap" );
     level_cache &map_cache = get_cache( zlev );
     auto &lm = map_cache.lm;
     auto &sm = map_cache.sm;
@@ -808,7 +810,7 @@ lit_level map::apparent_light_at( const tripoint_bub_ms &p,
     if( cache.u_clairvoyance > 0 && dist <= cache.u_clairvoyance ) {
         return lit_level::BRIGHT;
     }
-    if( cache.clairvoyance_field && field_at( p ).find_field( *cache.clairvoyance_field ) ) {
+    if( cache.clairvoyance_field && get_field( p, *cache.clairvoyance_field ) ) {
         return lit_level::BRIGHT;
     }
     const level_cache &map_cache = get_cache_ref( p.z() );
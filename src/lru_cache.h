@@ -2,9 +2,13 @@
 #ifndef CATA_SRC_LRU_CACHE_H
 #define CATA_SRC_LRU_CACHE_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 template<typename Key, typename Value>
 class lru_cache
@@ -85,4 +89,171 @@ inline void lru_cache<Key, Value>::clear()
     ordered_list.clear();
 }
 
+/**
+ * Same interface as lru_cache, but the entries live in one flat table that is
+ * allocated on the first insert, so inserting never allocates.
+ * The table is split into small sets of ways like a CPU cache: a key can only
+ * live in the set its hash picks, and when that set is full its least recently
+ * used entry is replaced. The limit passed to insert() is therefore only roughly
+ * followed (the table holds the limit rounded up to a power of two, and a busy set
+ * may drop entries before the table is full), which is fine for caches of things
+ * that can be recomputed.
+ * clear() is O(1), entries from before the last clear are told apart by an epoch.
+ * Key and Value must be default constructible and cheap to copy.
+ */
+template<typename Key, typename Value>
+class flat_lru_cache
+{
+    public:
+        Value get( const Key &, const Value &default_ ) const;
+        void insert( int limit, const Key &, const Value & );
+        void remove( const Key & );
+
+        void clear();
+    private:
+        static constexpr size_t ways = 8;
+
+        struct slot {
+            Key key;
+            Value value;
+            // The slot is in use when this matches the cache's epoch
+            uint32_t epoch = 0;
+            // Value of the cache's clock when the entry was last touched
+            uint32_t last_used = 0;
+        };
+
+        bool in_use( const slot &s ) const {
+            return s.epoch == epoch;
+        }
+        // Index of the first slot of the set key belongs to
+        size_t set_of( const Key &key ) const;
+        // The slot holding key, or nullptr
+        slot *find( const Key &key ) const;
+        void resize( int limit );
+
+        mutable std::vector<slot> slots;
+        mutable uint32_t clock = 0;
+        int shift = 0;
+        size_t count = 0;
+        size_t max_count = 0;
+        uint32_t epoch = 1;
+};
+
+template<typename Key, typename Value>
+inline size_t flat_lru_cache<Key, Value>::set_of( const Key &key ) const
+{
+    // Fibonacci hashing spreads weak hashes over the table before picking a set
+    const uint64_t h = static_cast<uint64_t>( std::hash<Key>()( key ) );
+    return static_cast<size_t>( ( h * 0x9E3779B97F4A7C15ULL ) >> shift ) * ways;
+}
+
+template<typename Key, typename Value>
+inline typename flat_lru_cache<Key, Value>::slot *flat_lru_cache<Key, Value>::find(
+    const Key &key ) const
+{
+    const size_t first = set_of( key );
+    for( size_t i = first; i < first + ways; ++i ) {
+        if( in_use( slots[i] ) && slots[i].key == key ) {
+            return &slots[i];
+        }
+    }
+    return nullptr;
+}
+
+template<typename Key, typename Value>
+inline Value flat_lru_cache<Key, Value>::get( const Key &key, const Value &default_ ) const
+{
+    if( count == 0 ) {
+        return default_;
+    }
+    slot *found = find( key );
+    if( found == nullptr ) {
+        return default_;
+    }
+    found->last_used = ++clock;
+    return found->value;
+}
+
+template<typename Key, typename Value>
+inline void flat_lru_cache<Key, Value>::insert( int limit, const Key &key, const Value &value )
+{
+    if( limit <= 0 ) {
+        return;
+    }
+    if( static_cast<size_t>( limit ) != max_count ) {
+        resize( limit );
+    }
+    const size_t first = set_of( key );
+    slot *target = nullptr;
+    for( size_t i = first; i < first + ways; ++i ) {
+        slot &s = slots[i];
+        if( !in_use( s ) ) {
+            if( target == nullptr || in_use( *target ) ) {
+                target = &s;
+            }
+        } else if( s.key == key ) {
+            target = &s;
+            break;
+        } else if( target == nullptr ||
+                   ( in_use( *target ) && s.last_used - clock < target->last_used - clock ) ) {
+            // Unsigned distance from the clock, so wrapping around keeps the order
+            target = &s;
+        }
+    }
+    if( !in_use( *target ) ) {
+        target->epoch = epoch;
+        count++;
+    }
+    target->key = key;
+    target->value = value;
+    target->last_used = ++clock;
+}
+
+template<typename Key, typename Value>
+inline void flat_lru_cache<Key, Value>::remove( const Key &key )
+{
+    if( count == 0 ) {
+        return;
+    }
+    if( slot *found = find( key ) ) {
+        found->epoch = 0;
+        count--;
+    }
+}
+
+template<typename Key, typename Value>
+inline void flat_lru_cache<Key, Value>::resize( int limit )
+{
+    size_t sets = 2;
+    int bits = 1;
+    while( sets * ways < static_cast<size_t>( limit ) ) {
+        sets *= 2;
+        bits++;
+    }
+    std::vector<slot> old = std::move( slots );
+    const uint32_t old_epoch = epoch;
+    slots.assign( sets * ways, slot() );
+    shift = 64 - bits;
+    count = 0;
+    epoch = 1;
+    max_count = static_cast<size_t>( limit );
+    for( const slot &s : old ) {
+        if( s.epoch == old_epoch ) {
+            insert( limit, s.key, s.value );
+        }
+    }
+}
+
+template<typename Key, typename Value>
+inline void flat_lru_cache<Key, Value>::clear()
+{
+    count = 0;
+    if( ++epoch == 0 ) {
+        for( slot &s : slots ) {
+            s.epoch = 0;
+        }
+        epoch = 1;
+    }
+}
+
 #endif // CATA_SRC_LRU_CACHE_H
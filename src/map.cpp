@@ -8,6 +8,7 @@
 #include <optional>
 #include <ostream>
 #include <queue>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -80,6 +81,7 @@
 #include "overmap.h"
 #include "overmapbuffer.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "pocket_type.h"
 #include "projectile.h"
 #include "ranged.h"
@@ -349,6 +351,13 @@ void map::set_floor_cache_dirty( const int zlev )
     }
 }
 
+void map::set_scent_cache_dirty( const int zlev )
+{
+    if( inbounds_z( zlev ) ) {
+        get_cache( zlev ).scent_cache_dirty = true;
+    }
+}
+
 bool map::memory_cache_dec_is_dirty( const tripoint_bub_ms &p ) const
 {
     if( !inbounds( p ) ) {
@@ -404,6 +413,7 @@ void map::invalidate_map_cache( const int zlev )
         ch.floor_cache_dirty = true;
         ch.seen_cache_dirty = true;
         ch.outside_cache_dirty = true;
+        ch.scent_cache_dirty = true;
         set_transparency_cache_dirty( zlev );
     }
 }
@@ -1843,6 +1853,11 @@ bool map::furn_set( const tripoint_bub_ms &p, const furn_id &new_furniture, cons
         set_floor_cache_dirty( p.z() + 1 );
     }
 
+    if( old_f.has_flag( ter_furn_flag::TFLAG_REDUCE_SCENT ) != new_f.has_flag(
+            ter_furn_flag::TFLAG_REDUCE_SCENT ) ) {
+        set_scent_cache_dirty( p.z() );
+    }
+
     invalidate_max_populated_zlev( p.z() );
 
     memory_cache_dec_set_dirty( p, true );
@@ -2265,6 +2280,13 @@ bool map::ter_set( const tripoint_bub_ms &p, const ter_id &new_terrain, bool avo
         set_seen_cache_dirty( p );
     }
 
+    if( old_t.has_flag( ter_furn_flag::TFLAG_NO_SCENT ) != new_t.has_flag(
+            ter_furn_flag::TFLAG_NO_SCENT ) ||
+        old_t.has_flag( ter_furn_flag::TFLAG_REDUCE_SCENT ) != new_t.has_flag(
+            ter_furn_flag::TFLAG_REDUCE_SCENT ) ) {
+        set_scent_cache_dirty( p.z() );
+    }
+
     if( !new_t.liquid_source_item_id.is_null() &&
         new_t.liquid_source_count != std::make_pair( 0, 0 ) ) {
         item water( new_t.liquid_source_item_id, calendar::start_of_cataclysm );
@@ -3575,7 +3597,7 @@ bool map::terrain_moppable( const tripoint_bub_ms &p )
     }
 
     // Moppable fields ( blood )
-    for( const std::pair<const field_type_id, field_entry> &pr : field_at( p ) ) {
+    for( const std::pair<field_type_id, field_entry> &pr : field_at( p ) ) {
         if( pr.first->phase == phase_id::LIQUID || pr.first->moppable ) {
             return true;
         }
@@ -4339,7 +4361,7 @@ void map::bash_vehicle( const tripoint_bub_ms &p, bash_params &params )
 void map::bash_field( const tripoint_bub_ms &p, bash_params &params )
 {
     std::vector<field_type_id> to_remove;
-    for( const std::pair<const field_type_id, field_entry> &fd : field_at( p ) ) {
+    for( const std::pair<field_type_id, field_entry> &fd : field_at( p ) ) {
         if( fd.first->bash_info && !fd.first->indestructible ) {
             params.did_bash = true;
             params.bashed_solid = true; // To prevent bashing furniture/vehicles
@@ -4658,7 +4680,7 @@ double map::shoot( const tripoint_bub_ms &p, projectile &proj, const bool hit_it
     if( fields_there.field_count() > 0 ) {
         // Need to make a copy since 'remove_field' modifies the value
         field fields_copy = fields_there;
-        for( const std::pair<const field_type_id, field_entry> &fd : fields_copy ) {
+        for( const std::pair<field_type_id, field_entry> &fd : fields_copy ) {
             const std::optional<map_fd_bash_info> &bash_info = fd.first->bash_info;
             if( bash_info && bash_info->str_min > 0 && !fd.first->indestructible ) {
                 if( incendiary ) {
@@ -5679,6 +5701,7 @@ static void process_vehicle_items( vehicle &cur_veh, int part )
 
 void map::process_items()
 {
+    turn_profile_scope profile( "process_items" );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z();
     for( int gz = minz; gz <= maxz; ++gz ) {
@@ -6584,7 +6607,7 @@ bool map::dangerous_field_at( const tripoint_bub_ms &p )
 
 bool map::mopsafe_field_at( const tripoint_bub_ms &p )
 {
-    for( const std::pair<const int_id<field_type>, field_entry> &pr : field_at( p ) ) {
+    for( const std::pair<field_type_id, field_entry> &pr : field_at( p ) ) {
         const field_entry &fd = pr.second;
         if( !fd.is_mopsafe() ) {
             return false;
@@ -6861,7 +6884,23 @@ void map::update_visibility_cache( const int zlev )
 
     cata::mdarray<int, point_bub_sm> sm_squares_seen = {};
 
-    auto &visibility_cache = get_cache( zlev ).visibility_cache;
+    level_cache &map_cache = get_cache( zlev );
+    auto &visibility_cache = map_cache.visibility_cache;
+
+    // Most of the reality bubble is usually out of sight. Such tiles are always BLANK
+    // unless clairvoyance applies, so find them in one branch-free pass over the
+    // visibility caches (which the compiler can vectorize) before doing the full
+    // per-tile evaluation for the rest.
+    cata::mdarray<bool, point_bub_ms> unseen;
+    const cata::mdarray<float, point_bub_ms> &seen_cache = map_cache.seen_cache;
+    const cata::mdarray<float, point_bub_ms> &camera_cache = map_cache.camera_cache;
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            unseen[x][y] = std::max( seen_cache[x][y], camera_cache[x][y] ) <= LIGHT_TRANSPARENCY_SOLID;
+        }
+    }
+    const int clairvoyance = visibility_variables_cache.u_clairvoyance;
+    const bool check_clairvoyance_field = visibility_variables_cache.clairvoyance_field.has_value();
 
     tripoint_bub_ms p;
     p.z() = zlev;
@@ -6869,6 +6908,11 @@ void map::update_visibility_cache( const int zlev )
     int &y = p.y();
     for( x = 0; x < MAPSIZE_X; x++ ) {
         for( y = 0; y < MAPSIZE_Y; y++ ) {
+            if( unseen[x][y] && ( clairvoyance <= 0 || rl_dist( pos, p ) > clairvoyance ) &&
+                ( !check_clairvoyance_field || !has_field_at( p, false ) ) ) {
+                visibility_cache[x][y] = lit_level::BLANK;
+                continue;
+            }
             lit_level ll = apparent_light_at( p, visibility_variables_cache );
             visibility_cache[x][y] = ll;
             sm_squares_seen[ x / SEEX ][ y / SEEY ] += ( ll == lit_level::BRIGHT || ll == lit_level::LIT );
@@ -8048,6 +8092,33 @@ shift_bitset_cache<MAPSIZE_X, SEEX>( std::bitset<MAPSIZE_X *MAPSIZE_X> &cache,
 template void
 shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, const point_rel_sm &s );
 
+void map::prefetch_submaps( const point_rel_sm &direction, int lookahead ) const
+{
+    if( !zlevels || direction == point_rel_sm::zero ) {
+        return;
+    }
+    const tripoint_abs_sm abs = get_abs_sub();
+    std::set<tripoint_abs_omt> quads;
+    for( int step = 1; step <= lookahead; step++ ) {
+        // Only submaps that the previous step would not have brought in yet
+        const point_abs_sm origin = abs.xy() + direction * step;
+        const half_open_rectangle<point_abs_sm> previous( abs.xy() + direction * ( step - 1 ),
+                abs.xy() + direction * ( step - 1 ) + point( my_MAPSIZE, my_MAPSIZE ) );
+        for( int x = 0; x < my_MAPSIZE; x++ ) {
+            for( int y = 0; y < my_MAPSIZE; y++ ) {
+                const point_abs_sm p = origin + point( x, y );
+                if( previous.contains( p ) ) {
+                    continue;
+                }
+                for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+                    quads.insert( project_to<coords::omt>( tripoint_abs_sm( p, z ) ) );
+                }
+            }
+        }
+    }
+    MAPBUFFER.prefetch( std::vector<tripoint_abs_omt>( quads.begin(), quads.end() ) );
+}
+
 void map::shift( const point_rel_sm &sp )
 {
     if( !zlevels ) {
@@ -8205,6 +8276,7 @@ void map::saven( const tripoint_bub_sm &grid )
     dbg( D_INFO ) << "map::saven abs: " << abs
                   << "  gridn: " << gridn;
     submap_to_save->last_touched = calendar::turn;
+    submap_to_save->unsaved_changes = true;
     MAPBUFFER.add_submap( abs, submap_to_save );
 }
 
@@ -8302,6 +8374,7 @@ void map::loadn( const point_bub_sm &grid, bool update_vehicles )
         set_seen_cache_dirty( z );
         set_outside_cache_dirty( z );
         set_floor_cache_dirty( z );
+        set_scent_cache_dirty( z );
         set_pathfinding_cache_dirty( z );
         tmpsub = MAPBUFFER.lookup_submap( pos );
         setsubmap( get_nonant( tripoint_rel_sm{ grid.x(), grid.y(), z} ), tmpsub );
@@ -9650,6 +9723,7 @@ void map::do_vehicle_caching( int z )
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
+    turn_profile_scope profile( "vision" );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
@@ -9856,6 +9930,7 @@ void map::draw_fill_background( const ter_id &type )
     set_transparency_cache_dirty( abs_sub.z() );
     set_seen_cache_dirty( abs_sub.z() );
     set_outside_cache_dirty( abs_sub.z() );
+    set_scent_cache_dirty( abs_sub.z() );
     set_pathfinding_cache_dirty( abs_sub.z() );
 
     // Fill each submap rather than each tile
@@ -10277,33 +10352,45 @@ void map::function_over( const tripoint_bub_ms &start, const tripoint_bub_ms &en
     }
 }
 
-void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &blocks_scent,
-                          std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &reduces_scent,
-                          const point_bub_ms &min, const point_bub_ms &max )
+void map::build_scent_cache( const int zlev )
 {
-    ter_furn_flag reduce = ter_furn_flag::TFLAG_REDUCE_SCENT;
-    ter_furn_flag block = ter_furn_flag::TFLAG_NO_SCENT;
+    level_cache &ch = get_cache( zlev );
+    if( !ch.scent_cache_dirty ) {
+        return;
+    }
+
+    const ter_furn_flag reduce = ter_furn_flag::TFLAG_REDUCE_SCENT;
+    const ter_furn_flag block = ter_furn_flag::TFLAG_NO_SCENT;
     auto fill_values = [&]( const tripoint_rel_sm & gp, const submap * sm, const point_sm_ms & lp ) {
         // We need to generate the x/y coordinates, because we can't get them "for free"
         const point_sm_ms p = lp + coords::project_to<coords::ms>( gp.xy() );
-        if( sm->get_ter( lp ).obj().has_flag( block ) ) {
-            blocks_scent[p.x()][p.y()] = true;
-            reduces_scent[p.x()][p.y()] = false;
-        } else if( sm->get_ter( lp ).obj().has_flag( reduce ) ||
-                   sm->get_furn( lp ).obj().has_flag( reduce ) ) {
-            blocks_scent[p.x()][p.y()] = false;
-            reduces_scent[p.x()][p.y()] = true;
-        } else {
-            blocks_scent[p.x()][p.y()] = false;
-            reduces_scent[p.x()][p.y()] = false;
-        }
-
+        const bool blocks = sm->get_ter( lp ).obj().has_flag( block );
+        ch.scent_blocked_cache[p.x()][p.y()] = blocks;
+        ch.scent_reduced_cache[p.x()][p.y()] = !blocks &&
+                                               ( sm->get_ter( lp ).obj().has_flag( reduce ) ||
+                                                 sm->get_furn( lp ).obj().has_flag( reduce ) );
         return ITER_CONTINUE;
     };
 
-    function_over( tripoint_bub_ms( min, abs_sub.z() ), tripoint_bub_ms( max, abs_sub.z() ),
+    function_over( tripoint_bub_ms( 0, 0, zlev ),
+                   tripoint_bub_ms( SEEX * my_MAPSIZE - 1, SEEY * my_MAPSIZE - 1, zlev ),
                    fill_values );
 
+    ch.scent_cache_dirty = false;
+}
+
+void map::scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &blocks_scent,
+                          std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &reduces_scent,
+                          const point_bub_ms &min, const point_bub_ms &max )
+{
+    build_scent_cache( abs_sub.z() );
+    const level_cache &ch = get_cache_ref( abs_sub.z() );
+    const int height = max.y() - min.y() + 1;
+    for( int x = min.x(); x <= max.x(); ++x ) {
+        std::copy_n( &ch.scent_blocked_cache[x][min.y()], height, &blocks_scent[x][min.y()] );
+        std::copy_n( &ch.scent_reduced_cache[x][min.y()], height, &reduces_scent[x][min.y()] );
+    }
+
     const inclusive_rectangle<point_bub_ms> local_bounds( min, max );
 
     // Now vehicles
@@ -10618,6 +10705,9 @@ void map::update_pathfinding_cache( int zlev ) const
 {
     pathfinding_cache &cache = get_pathfinding_cache( zlev );
 
+    // Shared by all maps, so that a generation never identifies two different caches
+    static uint64_t last_generation = 0;
+
     if( cache.dirty ) {
         const int size = getmapsize();
         for( int x = 0; x < size * SEEX; ++x ) {
@@ -10626,10 +10716,14 @@ void map::update_pathfinding_cache( int zlev ) const
             }
         }
         cache.dirty = false;
-    } else {
+        cache.generation = ++last_generation;
+    } else if( !cache.dirty_points.empty() ) {
         for( const point_bub_ms &p : cache.dirty_points ) {
             update_pathfinding_cache( { p, zlev } );
         }
+        // The flags are too coarse to tell whether the cost of passing changed (a door
+        // turning into a wall is an obstacle either way), so any dirty point counts.
+        cache.generation = ++last_generation;
     }
     cache.dirty_points.clear();
 }
@@ -97,6 +97,7 @@ class map;
 
 enum class ter_furn_flag : int;
 struct pathfinding_cache;
+struct pathfinding_distance_field;
 struct pathfinding_settings;
 struct pathfinding_target;
 template<typename T>
@@ -420,6 +421,7 @@ class map
         void set_seen_cache_dirty( int zlevel );
         void set_outside_cache_dirty( int zlev );
         void set_floor_cache_dirty( int zlev );
+        void set_scent_cache_dirty( int zlev );
         void set_pathfinding_cache_dirty( int zlev );
         void set_pathfinding_cache_dirty( const tripoint_bub_ms &p );
         /*@}*/
@@ -530,6 +532,11 @@ class map
          * Note: the map must have been loaded before this can be called.
          */
         void shift( const point_rel_sm &s );
+        /**
+         * Ask @ref mapbuffer to start reading the submaps that further shifts along
+         * direction would load, up to lookahead shifts ahead.
+         */
+        void prefetch_submaps( const point_rel_sm &direction, int lookahead ) const;
         /**
          * Moves the map vertically to (not by!) newz.
          * Does not actually shift anything, only forces cache updates.
@@ -754,6 +761,9 @@ class map
         int extra_cost( const tripoint_bub_ms &cur, const tripoint_bub_ms &p,
                         const pathfinding_settings &settings,
                         PathfindingFlags p_special ) const;
+        // Fills |field| with the cost of the cheapest path from every tile around its
+        // target to the target, using the same costs as route().
+        void build_distance_field( pathfinding_distance_field &field ) const;
     public:
 
         // Vehicles: Common to 2D and 3D
@@ -1594,7 +1604,8 @@ class map
         // Scent propagation helpers
         /**
          * Build the map of scent-resistant tiles.
-         * Should be way faster than if done in `game.cpp` using public map functions.
+         * Terrain and furniture come from a per-level cache that is only rebuilt after
+         * they changed, vehicles are added on top every call.
          */
         void scent_blockers( std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &blocks_scent,
                              std::array<std::array<bool, MAPSIZE_X>, MAPSIZE_Y> &reduces_scent,
@@ -1902,6 +1913,7 @@ class map
         bool build_vision_transparency_cache( int zlev );
         // fills lm with sunlight. pzlev is current player's zlevel
         void build_sunlight_cache( int pzlev );
+        void build_scent_cache( int zlev );
     public:
         void build_outside_cache( int zlev );
         // Get a bitmap indicating which layers are potentially visible from the target layer.
@@ -2146,7 +2158,7 @@ class map
         /**
          * Cache of coordinate pairs recently checked for visibility.
          */
-        using lru_cache_t = lru_cache<point, char>;
+        using lru_cache_t = flat_lru_cache<point, char>;
         mutable lru_cache_t skew_vision_cache;
         mutable lru_cache_t skew_vision_wo_fields_cache;
 
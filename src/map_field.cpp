@@ -50,6 +50,7 @@
 #include "mtype.h"
 #include "npc.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "point.h"
 #include "rng.h"
 #include "scent_block.h"
@@ -163,6 +164,7 @@ int map::burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp
 
 void map::process_fields()
 {
+    turn_profile_scope profile( "process_fields" );
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
@@ -471,7 +473,7 @@ void map::process_fields_in_submap( submap *const current_submap,
                 if( prev_intensity == 0 ) {
                     on_field_modified( p, *pd.cur_fd_type );
                     --current_submap->field_count;
-                    curfield.remove_field( it++ );
+                    it = curfield.remove_field( it );
                     continue;
                 }
 
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <functional>
@@ -7,6 +8,7 @@
 #include <memory>
 #include <ostream>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "cached_options.h"
@@ -107,6 +109,36 @@ bool mm_region::is_empty() const
     return true;
 }
 
+namespace
+{
+// Decoration ids come from a small set (furniture, traps, vehicle parts ...) but are
+// remembered for every tile the avatar has seen, so each distinct id is kept only once
+// and tiles store its index. Index 0 is the empty id.
+struct interned_dec_ids {
+    // deque so references handed out by get_dec_id() stay valid as ids are added
+    std::deque<std::string> ids{ std::string() };
+    std::unordered_map<std::string, int> index{ { std::string(), 0 } };
+
+    int intern( std::string_view id ) {
+        std::string key( id );
+        const auto it = index.find( key );
+        if( it != index.end() ) {
+            return it->second;
+        }
+        const int idx = static_cast<int>( ids.size() );
+        ids.push_back( key );
+        index.emplace( std::move( key ), idx );
+        return idx;
+    }
+};
+
+interned_dec_ids &dec_ids()
+{
+    static interned_dec_ids instance;
+    return instance;
+}
+} // namespace
+
 const std::string &memorized_tile::get_ter_id() const
 {
     return ter_id.str();
@@ -114,7 +146,7 @@ const std::string &memorized_tile::get_ter_id() const
 
 const std::string &memorized_tile::get_dec_id() const
 {
-    return dec_id;
+    return dec_ids().ids[dec_id];
 }
 
 void memorized_tile::set_ter_id( std::string_view id )
@@ -124,7 +156,7 @@ void memorized_tile::set_ter_id( std::string_view id )
 
 void memorized_tile::set_dec_id( std::string_view id )
 {
-    dec_id = id;
+    dec_id = id.empty() ? 0 : dec_ids().intern( id );
 }
 
 int memorized_tile::get_ter_rotation() const
@@ -187,6 +219,58 @@ void memorized_tile::set_dec_subtile( int subtile )
     dec_subtile = subtile;
 }
 
+int mm_region_ids::index_of_ter( const ter_str_id &id )
+{
+    const auto it = ter_index.find( id );
+    if( it != ter_index.end() ) {
+        return it->second;
+    }
+    const int idx = static_cast<int>( ids.size() );
+    ids.push_back( id.str() );
+    ter_index.emplace( id, idx );
+    return idx;
+}
+
+int mm_region_ids::index_of_dec( const memorized_tile &tile )
+{
+    const auto it = dec_index.find( tile.dec_id );
+    if( it != dec_index.end() ) {
+        return it->second;
+    }
+    const int idx = static_cast<int>( ids.size() );
+    ids.push_back( tile.get_dec_id() );
+    dec_index.emplace( tile.dec_id, idx );
+    return idx;
+}
+
+const ter_str_id &mm_region_ids::ter_at( const JsonArray &ja, int pos )
+{
+    const int idx = ja.get_int( pos );
+    if( idx < 0 || static_cast<size_t>( idx ) >= ids.size() ) {
+        ja[pos].throw_error( "map memory id index out of range" );
+    }
+    ters.resize( ids.size() );
+    if( !ters[idx] ) {
+        ters[idx] = ter_str_id( ids[idx] );
+    }
+    return *ters[idx];
+}
+
+int mm_region_ids::dec_at( const JsonArray &ja, int pos )
+{
+    const int idx = ja.get_int( pos );
+    if( idx < 0 || static_cast<size_t>( idx ) >= ids.size() ) {
+        ja[pos].throw_error( "map memory id index out of range" );
+    }
+    decs.resize( ids.size() );
+    if( !decs[idx] ) {
+        memorized_tile tmp;
+        tmp.set_dec_id( ids[idx] );
+        decs[idx] = tmp.dec_id;
+    }
+    return *decs[idx];
+}
+
 bool memorized_tile::operator==( const memorized_tile &rhs ) const
 {
     return symbol == rhs.symbol &&
@@ -456,6 +540,10 @@ void map_memory::load( const tripoint_abs_ms &pos )
     dbg( D_INFO ) << "[LOAD] Loading memory map around " << p.sm << ". Loading submaps within " << start
                   << "->" << start + tripoint( MM_SIZE, MM_SIZE, 0 );
     clear_cache();
+    if( submaps.empty() ) {
+        // Nothing remembered refers to the ids interned while playing another world
+        dec_ids() = interned_dec_ids();
+    }
     for( int dy = 0; dy < MM_SIZE; dy++ ) {
         for( int dx = 0; dx < MM_SIZE; dx++ ) {
             fetch_submap( start + tripoint_rel_sm( dx, dy, 0 ) );
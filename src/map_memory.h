@@ -4,8 +4,10 @@
 
 #include <cstdint>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "coordinates.h"
@@ -45,14 +47,39 @@ class memorized_tile
         }
     private:
         friend struct mm_submap; // serialization needs access to private members
+        friend struct mm_region_ids;
         ter_str_id ter_id;       // terrain tile id
-        std::string dec_id;      // decoration tile id (furniture, vparts ...)
+        // decoration tile id (furniture, vparts ...), index into a table of interned ids
+        // shared by all tiles, see get_dec_id()
+        int dec_id = 0;
         int8_t ter_rotation = 0;
         int8_t dec_rotation = 0;
         int8_t ter_subtile = 0;
         int8_t dec_subtile = 0;
 };
 
+/**
+ * The ids used by the tiles of one saved mm_region. Each distinct id is written
+ * once per region and the tiles refer to it by its index in the list.
+ */
+struct mm_region_ids {
+    std::vector<std::string> ids;
+
+    // Used when saving
+    int index_of_ter( const ter_str_id &id );
+    int index_of_dec( const memorized_tile &tile );
+
+    // Used when loading, fail with a json error if the index is out of range
+    const ter_str_id &ter_at( const JsonArray &ja, int pos );
+    int dec_at( const JsonArray &ja, int pos );
+
+    private:
+        std::unordered_map<ter_str_id, int> ter_index;
+        std::unordered_map<int, int> dec_index;
+        std::vector<std::optional<ter_str_id>> ters;
+        std::vector<std::optional<int>> decs;
+};
+
 /** Represent a submap-sized chunk of tile memory. */
 struct mm_submap {
     public:
@@ -69,8 +96,8 @@ struct mm_submap {
         const memorized_tile &get_tile( const point_sm_ms &p ) const;
         void set_tile( const point_sm_ms &p, const memorized_tile &value );
 
-        void serialize( JsonOut &jsout ) const;
-        void deserialize( int version, const JsonArray &ja );
+        void serialize( JsonOut &jsout, mm_region_ids &ids ) const;
+        void deserialize( int version, const JsonArray &ja, mm_region_ids &ids );
 
     private:
         // NOLINTNEXTLINE(cata-serialize)
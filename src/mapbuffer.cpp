@@ -1,10 +1,13 @@
 #include "mapbuffer.h"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <exception>
 #include <filesystem>
 #include <functional>
+#include <future>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -31,6 +34,7 @@
 #include "std_hash_fs_path.h"
 #include "string_formatter.h"
 #include "submap.h"
+#include "thread_pool.h"
 #include "translations.h"
 #include "type_id.h"
 #include "ui_manager.h"
@@ -59,14 +63,159 @@ static cata_path find_dirname( const tripoint_abs_omt &om_addr )
             segment_addr.y(), segment_addr.z() );
 }
 
+// Upper bound on quads waiting to be picked up. When it is reached, finished reads of
+// predictions that never came true are dropped, and new hints are ignored while the
+// worker is still busy with the old ones.
+static constexpr size_t max_prefetched_quads = 512;
+// Each segment directory of a compressed world has its own archive
+static constexpr int max_open_zzips = 64;
+
+// Identifies the contents of a quad file, so a quad that would be written unchanged
+// can be skipped
+static size_t quad_hash( std::string_view contents )
+{
+    return std::hash<std::string_view>()( contents );
+}
+
+struct mapbuffer::prefetched_quad {
+    std::filesystem::path path;
+    // Only written by the worker before it fulfills the promise
+    std::optional<JsonValue> contents;
+    size_t hash = 0;
+    std::promise<void> read;
+    std::future<void> ready = read.get_future();
+};
+
+// Offsets of the submaps in a quad from its first one
+static const std::array<point_rel_sm, 4> quad_offsets = {
+    point_rel_sm::zero, point_rel_sm::south, point_rel_sm::east, point_rel_sm::south_east
+};
+
 mapbuffer MAPBUFFER;
 
 mapbuffer::mapbuffer() = default;
-mapbuffer::~mapbuffer() = default;
+mapbuffer::~mapbuffer()
+{
+    drop_prefetched();
+}
 
 void mapbuffer::clear()
 {
+    drop_prefetched();
     submaps.clear();
+    quad_hashes.clear();
+    zzips.clear();
+}
+
+std::shared_ptr<zzip> mapbuffer::open_zzip( const cata_path &dirname, bool create )
+{
+    cata_path zzip_name = dirname;
+    zzip_name += ".zzip";
+    const std::string key = zzip_name.get_unrelative_path().generic_u8string();
+    const std::optional<std::shared_ptr<zzip>> cached = zzips.get( key, std::nullopt );
+    if( cached && ( *cached || !create ) ) {
+        return *cached;
+    }
+    std::shared_ptr<zzip> z;
+    if( create || file_exist( zzip_name ) ) {
+        z = zzip::load( zzip_name.get_unrelative_path(),
+                        ( PATH_INFO::world_base_save_path() / "maps.dict" ).get_unrelative_path() );
+    }
+    zzips.insert( max_open_zzips, key, z );
+    return z;
+}
+
+void mapbuffer::prefetch( const std::vector<tripoint_abs_omt> &quads )
+{
+    thread_pool &pool = get_thread_pool();
+    // zzip shares its zstd contexts between all open archives, so compressed
+    // worlds can only be read from the main thread.
+    if( pool.num_workers() == 0 || world_generator->active_world == nullptr ||
+        world_generator->active_world->has_compression_enabled() ) {
+        return;
+    }
+    if( prefetched.size() + quads.size() > max_prefetched_quads ) {
+        drop_finished_prefetches();
+    }
+
+    std::vector<std::shared_ptr<prefetched_quad>> to_read;
+    for( const tripoint_abs_omt &om_addr : quads ) {
+        if( prefetched.size() >= max_prefetched_quads ) {
+            break;
+        }
+        if( submaps.count( project_to<coords::sm>( om_addr ) ) != 0 ||
+            prefetched.count( om_addr ) != 0 ) {
+            continue;
+        }
+        std::shared_ptr<prefetched_quad> quad = std::make_shared<prefetched_quad>();
+        quad->path = ( find_dirname( om_addr ) / quad_file_name( om_addr ) ).get_unrelative_path();
+        prefetched.emplace( om_addr, quad );
+        to_read.push_back( std::move( quad ) );
+    }
+    if( to_read.empty() ) {
+        return;
+    }
+
+    pool.submit( [to_read = std::move( to_read )]() {
+        for( const std::shared_ptr<prefetched_quad> &quad : to_read ) {
+            try {
+                if( file_exist( quad->path ) ) {
+                    if( std::optional<std::string> data = read_whole_file( quad->path ) ) {
+                        quad->hash = quad_hash( *data );
+                        quad->contents = json_loader::from_string( std::move( *data ) );
+                    }
+                }
+            } catch( ... ) {
+                // Leave it to the main thread to read the file again and report the error
+                quad->contents.reset();
+            }
+            quad->read.set_value();
+        }
+    } );
+}
+
+std::optional<JsonValue> mapbuffer::take_prefetched( const tripoint_abs_omt &om_addr,
+        size_t &hash )
+{
+    const auto it = prefetched.find( om_addr );
+    if( it == prefetched.end() ) {
+        return std::nullopt;
+    }
+    std::shared_ptr<prefetched_quad> quad = std::move( it->second );
+    prefetched.erase( it );
+    quad->ready.wait();
+    hash = quad->hash;
+    return std::move( quad->contents );
+}
+
+void mapbuffer::drop_prefetched()
+{
+    // The worker must be done with the files before the world goes away
+    for( std::pair<const tripoint_abs_omt, std::shared_ptr<prefetched_quad>> &elem : prefetched ) {
+        elem.second->ready.wait();
+    }
+    prefetched.clear();
+}
+
+void mapbuffer::drop_finished_prefetches()
+{
+    for( auto it = prefetched.begin(); it != prefetched.end(); ) {
+        if( it->second->ready.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready ) {
+            it = prefetched.erase( it );
+        } else {
+            ++it;
+        }
+    }
+}
+
+void mapbuffer::drop_prefetched( const tripoint_abs_omt &om_addr )
+{
+    const auto it = prefetched.find( om_addr );
+    if( it != prefetched.end() ) {
+        // A read still in progress might see the file halfway through being written
+        it->second->ready.wait();
+        prefetched.erase( it );
+    }
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -120,16 +269,22 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
     dbg( D_INFO ) << "mapbuffer::lookup_submap( x[" << p.x() << "], y[" << p.y() << "], z["
                   << p.z() << "])";
 
+    // Whoever asked may change the submap, so it needs saving from now on
     const auto iter = submaps.find( p );
     if( iter == submaps.end() ) {
         try {
-            return unserialize_submaps( p );
+            submap *sm = unserialize_submaps( p );
+            if( sm != nullptr ) {
+                sm->unsaved_changes = true;
+            }
+            return sm;
         } catch( const std::exception &err ) {
             debugmsg( "Failed to load submap %s: %s", p.to_string(), err.what() );
         }
         return nullptr;
     }
 
+    iter->second->unsaved_changes = true;
     return iter->second.get();
 }
 
@@ -159,14 +314,8 @@ bool mapbuffer::submap_exists_approx( const tripoint_abs_sm &p )
             std::string file_name = quad_file_name( om_addr );
 
             if( world_generator->active_world->has_compression_enabled() ) {
-                cata_path zzip_name = dirname;
-                zzip_name += ".zzip";
-                if( !file_exist( zzip_name ) ) {
-                    return false;
-                }
-                std::shared_ptr<zzip> z = zzip::load( zzip_name.get_unrelative_path(),
-                                                      ( PATH_INFO::world_base_save_path() / "maps.dict" ).get_unrelative_path() );
-                return z->has_file( std::filesystem::u8path( file_name ) );
+                std::shared_ptr<zzip> z = open_zzip( dirname, false );
+                return z && z->has_file( std::filesystem::u8path( file_name ) );
             } else {
                 return file_exist( dirname / file_name );
             }
@@ -190,45 +339,84 @@ void mapbuffer::save( bool delete_after_save )
 
     static_popup popup;
 
-    // A set of already-saved submaps, in global overmap coordinates.
-    std::set<tripoint_abs_omt> saved_submaps;
+    // The quads to save, by the segment they're stored in.
+    // A segment is a chunk of 32x32 submap quads, each has its own directory or archive.
+    // Submaps are generated in quads, so we know if we have one member of a quad,
+    // we have the rest of it, if that assumption is broken we have REAL problems.
+    std::map<tripoint_abs_seg, std::set<tripoint_abs_omt>> quads_by_segment;
+    for( auto &elem : submaps ) {
+        const tripoint_abs_omt om_addr = project_to<coords::omt>( elem.first );
+        quads_by_segment[project_to<coords::seg>( om_addr )].insert( om_addr );
+    }
     std::list<tripoint_abs_sm> submaps_to_delete;
+    zzip_entries zzip_writes;
     static constexpr std::chrono::milliseconds update_interval( 500 );
     std::chrono::steady_clock::time_point last_update = std::chrono::steady_clock::now();
 
-    for( auto &elem : submaps ) {
-        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
-        if( last_update + update_interval < now ) {
-            popup.message( _( "Please wait as the map saves [%d/%d]" ),
-                           num_saved_submaps, num_total_submaps );
-            ui_manager::redraw();
-            refresh_display();
-            inp_mngr.pump_events();
-            last_update = now;
+    for( const std::pair<const tripoint_abs_seg, std::set<tripoint_abs_omt>> &segment :
+         quads_by_segment ) {
+        const cata_path dirname = find_dirname( *segment.second.begin() );
+        for( const tripoint_abs_omt &om_addr : segment.second ) {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if( last_update + update_interval < now ) {
+                popup.message( _( "Please wait as the map saves [%d/%d]" ),
+                               num_saved_submaps, num_total_submaps );
+                ui_manager::redraw();
+                refresh_display();
+                inp_mngr.pump_events();
+                last_update = now;
+            }
+            const cata_path quad_path = dirname / quad_file_name( om_addr );
+
+            bool inside_reality_bubble = here.inbounds( om_addr );
+            std::array<tripoint_abs_sm, 4> quad_addrs;
+            std::array<submap *, 4> quad_submaps = {};
+            bool unsaved_changes = false;
+            for( size_t i = 0; i < quad_offsets.size(); i++ ) {
+                quad_addrs[i] = project_to<coords::sm>( om_addr ) + quad_offsets[i];
+                const auto it = submaps.find( quad_addrs[i] );
+                if( it != submaps.end() && it->second ) {
+                    quad_submaps[i] = it->second.get();
+                    unsaved_changes |= it->second->unsaved_changes;
+                }
+            }
+            // The reality bubble keeps pointers to its submaps and changes them without
+            // going through the mapbuffer, so it is always serialized. save_quad then
+            // only writes the quads whose contents differ from their files.
+            if( !unsaved_changes && !inside_reality_bubble ) {
+                // The file already matches what's in memory
+                for( size_t i = 0; i < quad_offsets.size(); i++ ) {
+                    if( quad_submaps[i] != nullptr ) {
+                        submaps_to_delete.push_back( quad_addrs[i] );
+                    }
+                }
+                num_saved_submaps += 4;
+                continue;
+            }
+            // delete_on_save deletes everything, otherwise delete submaps
+            // outside the current map.
+            save_quad( dirname, quad_path, om_addr, submaps_to_delete,
+                       delete_after_save || !inside_reality_bubble, zzip_writes );
+            for( submap *sm : quad_submaps ) {
+                if( sm != nullptr ) {
+                    sm->unsaved_changes = false;
+                }
+            }
+            num_saved_submaps += 4;
         }
-        // Whatever the coordinates of the current submap are,
-        // we're saving a 2x2 quad of submaps at a time.
-        // Submaps are generated in quads, so we know if we have one member of a quad,
-        // we have the rest of it, if that assumption is broken we have REAL problems.
-        const tripoint_abs_omt om_addr = project_to<coords::omt>( elem.first );
-        if( saved_submaps.count( om_addr ) != 0 ) {
-            // Already handled this one.
-            continue;
+        // The archive gets all quads of its segment at once, so they can be compressed in
+        // parallel. Done before moving on, so no other archive can push it out of the cache
+        // of open archives while it still has quads waiting, and only one segment's worth
+        // of quads is held in memory.
+        if( !zzip_writes.empty() ) {
+            const std::shared_ptr<zzip> z = open_zzip( dirname, true );
+            if( !z || !z->add_files( zzip_writes ) ) {
+                throw std::runtime_error( "Failed writing compressed save file " +
+                                          dirname.get_unrelative_path().generic_u8string() + ".zzip" );
+            }
+            z->compact( 2.0 );
+            zzip_writes.clear();
         }
-        saved_submaps.insert( om_addr );
-
-        // A segment is a chunk of 32x32 submap quads.
-        // We're breaking them into subdirectories so there aren't too many files per directory.
-        // Might want to make a set for this one too so it's only checked once per save().
-        const cata_path dirname = find_dirname( om_addr );
-        const cata_path quad_path = dirname / quad_file_name( om_addr );
-
-        bool inside_reality_bubble = here.inbounds( om_addr );
-        // delete_on_save deletes everything, otherwise delete submaps
-        // outside the current map.
-        save_quad( dirname, quad_path, om_addr, submaps_to_delete,
-                   delete_after_save || !inside_reality_bubble );
-        num_saved_submaps += 4;
     }
     for( auto &elem : submaps_to_delete ) {
         remove_submap( elem );
@@ -237,16 +425,11 @@ void mapbuffer::save( bool delete_after_save )
 
 void mapbuffer::save_quad(
     const cata_path &dirname, const cata_path &filename, const tripoint_abs_omt &om_addr,
-    std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save )
+    std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save,
+    zzip_entries &zzip_writes )
 {
-    std::vector<point_rel_sm> offsets;
     std::vector<tripoint_abs_sm> submap_addrs;
-    offsets.reserve( 4 );
-    submap_addrs.reserve( 4 );
-    offsets.push_back( point_rel_sm::zero );
-    offsets.push_back( point_rel_sm::south );
-    offsets.push_back( point_rel_sm::east );
-    offsets.push_back( point_rel_sm::south_east );
+    submap_addrs.reserve( quad_offsets.size() );
 
     bool all_uniform = true;
     bool reverted_to_uniform = false;
@@ -257,20 +440,17 @@ void mapbuffer::save_quad(
     // for this step of just checking if the quad exists approaches 70% of the
     // total cost of saving the mapbuffer, in one test save I had.
     if( world_generator->active_world->has_compression_enabled() ) {
-        cata_path zzip_name = dirname;
-        zzip_name += ".zzip";
-        z = zzip::load( zzip_name.get_unrelative_path(),
-                        ( PATH_INFO::world_base_save_path() / "maps.dict" ).get_unrelative_path() );
+        z = open_zzip( dirname, true );
         if( !z ) {
             throw std::runtime_error( "Failed opening compressed save file " +
-                                      zzip_name.get_unrelative_path().generic_u8string() );
+                                      dirname.get_unrelative_path().generic_u8string() + ".zzip" );
         }
         file_exists = z->has_file( filename.get_relative_path().filename() );
     } else {
         file_exists = std::filesystem::exists( filename.get_unrelative_path() );
     }
 
-    for( point_rel_sm &offsets_offset : offsets ) {
+    for( const point_rel_sm &offsets_offset : quad_offsets ) {
         tripoint_abs_sm submap_addr = project_to<coords::sm>( om_addr );
         submap_addr += offsets_offset.raw(); // TODO: Make += etc. available to relative parameters as well.
         submap_addrs.push_back( submap_addr );
@@ -339,10 +519,24 @@ void mapbuffer::save_quad(
 
     std::string s = std::move( stringout ).str();
 
+    if( !( all_uniform && reverted_to_uniform ) ) {
+        // Serializing it again gives what is already in the file, unless something changed
+        const size_t hash = quad_hash( s );
+        const auto known = quad_hashes.find( om_addr );
+        if( file_exists && known != quad_hashes.end() && known->second == hash ) {
+            return;
+        }
+        quad_hashes[om_addr] = hash;
+    }
+
     if( z ) {
-        z->add_file( filename.get_relative_path().filename(), s );
-        z->compact( 2.0 );
+        // Written by save() together with the rest of the archive, unless it goes away anyway
+        if( !( all_uniform && reverted_to_uniform ) ) {
+            zzip_writes.emplace_back( filename.get_relative_path().filename(), std::move( s ) );
+        }
     } else {
+        // What was read ahead is about to be overwritten
+        drop_prefetched( om_addr );
         // Don't create the directory if it would be empty
         assure_dir_exist( dirname );
         write_to_file( filename, [&]( std::ostream & fout ) {
@@ -351,6 +545,7 @@ void mapbuffer::save_quad(
     }
 
     if( all_uniform && reverted_to_uniform ) {
+        quad_hashes.erase( om_addr );
         if( z ) {
             z->delete_files( { filename.get_relative_path().filename() } );
         } else {
@@ -370,42 +565,62 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
     std::filesystem::path file_name_path = std::filesystem::u8path( file_name );
     cata_path quad_path = dirname / file_name;
 
+    size_t hash = 0;
     bool read = [&] {
-        if( world_generator->active_world->has_compression_enabled() )
+        if( std::optional<JsonValue> prefetched_json = take_prefetched( om_addr, hash ) )
         {
-            cata_path zzip_name = dirname;
-            zzip_name += ".zzip";
-            if( !file_exist( zzip_name ) ) {
+            try {
+                deserialize( *prefetched_json );
+            } catch( std::exception &err ) {
+                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), quad_path.generic_u8string(),
+                          err.what() );
                 return false;
             }
-            std::shared_ptr<zzip> z = zzip::load( zzip_name.get_unrelative_path(),
-                                                  ( PATH_INFO::world_base_save_path() / "maps.dict" ).get_unrelative_path() );
-            if( !z->has_file( file_name_path ) ) {
+            return true;
+        }
+        if( world_generator->active_world->has_compression_enabled() )
+        {
+            std::shared_ptr<zzip> z = open_zzip( dirname, false );
+            if( !z || !z->has_file( file_name_path ) ) {
                 return false;
             }
             std::vector<std::byte> contents = z->get_file( file_name_path );
             std::string_view string_contents{ reinterpret_cast<char *>( contents.data() ), contents.size() };
+            hash = quad_hash( string_contents );
             JsonValue jsin = json_loader::from_string( std::string( string_contents ) );
             try {
                 deserialize( jsin );
             } catch( std::exception &err ) {
-                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), zzip_name.generic_u8string() + ":" + file_name,
-                          err.what() );
+                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ),
+                          dirname.generic_u8string() + ".zzip:" + file_name, err.what() );
                 return false;
             }
             return true;
         } else
         {
-            return read_from_file_optional_json( quad_path, [this]( const JsonValue & jsin ) {
-                deserialize( jsin );
-            } );
-
+            if( !file_exist( quad_path ) ) {
+                return false;
+            }
+            std::optional<std::string> contents = read_whole_file( quad_path );
+            if( !contents ) {
+                return false;
+            }
+            hash = quad_hash( *contents );
+            try {
+                deserialize( json_loader::from_string( std::move( *contents ) ) );
+            } catch( std::exception &err ) {
+                debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), quad_path.generic_u8string(),
+                          err.what() );
+                return false;
+            }
+            return true;
         }
     }();
 
     if( !read ) {
         return nullptr;
     }
+    quad_hashes[om_addr] = hash;
 
     // fill in uniform submaps that were not serialized. Note that failure as a result of it
     // not being uniform is OK and results in any missing uniform submaps being generated.
@@ -440,6 +655,8 @@ void mapbuffer::deserialize( const JsonArray &ja )
             }
         }
 
+        // Freshly read, so the file is up to date
+        sm->unsaved_changes = false;
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %s was already loaded", submap_coordinates.to_string() );
         }
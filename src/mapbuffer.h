@@ -2,15 +2,24 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <cstddef>
+#include <filesystem>
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "coordinates.h"
+#include "lru_cache.h"
 
 class JsonArray;
+class JsonValue;
 class cata_path;
 class submap;
+class zzip;
 
 /**
  * Store, buffer, save and load the entire world map.
@@ -66,6 +75,16 @@ class mapbuffer
         // Cheaper version of the above for when you don't mind some false results
         bool submap_exists_approx( const tripoint_abs_sm &p );
 
+        /** Start reading the files of the given submap quads on a worker thread.
+         *
+         * Only a hint: quads that are already loaded or being read are skipped,
+         * and nothing is done without worker threads or for compressed worlds.
+         * A later @ref lookup_submap of a prefetched quad then only has to turn
+         * the already parsed json into submaps, which has to happen on the main
+         * thread as it touches global game data.
+         */
+        void prefetch( const std::vector<tripoint_abs_omt> &quads );
+
     private:
         using submap_map_t = std::map<tripoint_abs_sm, std::unique_ptr<submap>>;
 
@@ -82,13 +101,40 @@ class mapbuffer
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( const tripoint_abs_sm &addr );
         submap *unserialize_submaps( const tripoint_abs_sm &p );
+        // Json read by a worker for the quad, waiting for it if still in progress.
+        // Sets hash to that of the file contents.
+        std::optional<JsonValue> take_prefetched( const tripoint_abs_omt &om_addr, size_t &hash );
+        // Forget all prefetched quads, waiting for reads still in progress
+        void drop_prefetched();
+        // Forget the prefetched quad, waiting for its read if still in progress
+        void drop_prefetched( const tripoint_abs_omt &om_addr );
+        // Forget prefetched quads whose reads have finished, without waiting for the rest
+        void drop_finished_prefetches();
         bool submap_file_exists( const tripoint_abs_sm &p );
+        // Archive holding the quads of the directory in a compressed world. nullptr if
+        // there is none, unless create is set.
+        std::shared_ptr<zzip> open_zzip( const cata_path &dirname, bool create );
         void deserialize( const JsonArray &ja );
+        // Quad files to be written into one archive, as paths inside it and contents
+        using zzip_entries = std::vector<std::pair<std::filesystem::path, std::string>>;
+        // In a compressed world the quad is added to zzip_writes, which the caller writes
+        // into the archive of dirname
         void save_quad(
             const cata_path &dirname, const cata_path &filename,
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
-            bool delete_after_save );
+            bool delete_after_save, zzip_entries &zzip_writes );
         submap_map_t submaps; // NOLINT(cata-serialize)
+        struct prefetched_quad;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::map<tripoint_abs_omt, std::shared_ptr<prefetched_quad>> prefetched;
+        // Hash of each quad file as last read or written, to skip writing quads
+        // that would serialize to the same contents
+        // NOLINTNEXTLINE(cata-serialize)
+        std::map<tripoint_abs_omt, size_t> quad_hashes;
+        // Recently used archives by path, so their footers and the dictionary are only
+        // read once. Holds nullptr for archives known not to exist.
+        // NOLINTNEXTLINE(cata-serialize)
+        lru_cache<std::string, std::optional<std::shared_ptr<zzip>>> zzips;
 };
 
 extern mapbuffer MAPBUFFER;
@@ -514,7 +514,11 @@ void monster::plan()
         }
         anger_cub_threatened( mon_plan );
     } else if( friendly != 0 && !mon_plan.docile ) {
-        for( monster &tmp : g->all_monsters() ) {
+        // rate_target gives up on whatever we can't see
+        const int sight_limit = std::max( sight_range( 0.0f ),
+                                          sight_range( default_daylight_level() ) );
+        get_creature_tracker().for_each_monster_in_range( pos_abs(), sight_limit,
+        [&]( monster & tmp ) {
             if( tmp.friendly == 0 && tmp.attitude_to( *this ) == Attitude::HOSTILE &&
                 seen_levels.test( tmp.posz() + OVERMAP_DEPTH ) ) {
                 float rating = rate_target( tmp, mon_plan.dist, mon_plan.smart_planning );
@@ -523,7 +527,7 @@ void monster::plan()
                     mon_plan.dist = rating;
                 }
             }
-        }
+        } );
     }
 
     if( mon_plan.docile ) {
@@ -1554,7 +1558,7 @@ int monster::calc_movecost( const map &here, const tripoint_bub_ms &from,
     auto get_filtered_fieldcost = [&]( const field & field ) {
         int cost = 0;
         // filter fields wethere they are ignored
-        for( const auto [field_id, field_entry] : field ) {
+        for( const auto &[field_id, field_entry] : field ) {
             if( !is_immune_field( field_id ) ) {
                 const int mc = field_entry.get_intensity_level().move_cost;
                 if( mc >= 0 ) {
@@ -3234,12 +3234,11 @@ void monster::die( map *here, Creature *nkiller )
     if( trigger ) {
         int light = g->light_level( posz() );
         map &here = get_map();
-        for( monster &critter : g->all_monsters() ) {
-            // Do we actually care about this faction?
-            if( critter.faction->attitude( faction ) != MFA_FRIENDLY ) {
-                continue;
-            }
-
+        // Do we actually care about this faction? map::sees gives up beyond the light range.
+        get_creature_tracker().for_each_monster_in_range( pos_abs(), light,
+        [this]( const mfaction_id & other ) {
+            return other->attitude( faction ) == MFA_FRIENDLY;
+        }, [&]( monster & critter ) {
             if( here.sees( critter.pos_bub(), pos_bub(), light ) ) {
                 // Anger trumps fear trumps ennui
                 if( critter.type->has_anger_trigger( mon_trigger::FRIEND_DIED ) ) {
@@ -3256,7 +3255,7 @@ void monster::die( map *here, Creature *nkiller )
                     critter.anger -= 15;
                 }
             }
-        }
+        } );
     }
 }
 
@@ -3399,7 +3398,7 @@ void monster::spawn_dissectables_on_death( item *corpse ) const
                                          calendar::turn,
                                          spawn_flags::use_spawn_rate );
         for( item &dissectable : dissectables ) {
-            dissectable.dropped_from = entry.type;
+            dissectable.set_dropped_from( entry.type );
             for( const flag_id &flg : entry.flags ) {
                 dissectable.set_flag( flg );
             }
@@ -3933,12 +3932,11 @@ void monster::on_hit( map *here, Creature *source, bodypart_id,
 
     if( trigger ) {
         int light = g->light_level( posz() );
-        for( monster &critter : g->all_monsters() ) {
-            // Do we actually care about this faction?
-            if( critter.faction->attitude( faction ) != MFA_FRIENDLY ) {
-                continue;
-            }
-
+        // Do we actually care about this faction? map::sees gives up beyond the light range.
+        get_creature_tracker().for_each_monster_in_range( pos_abs(), light,
+        [this]( const mfaction_id & other ) {
+            return other->attitude( faction ) == MFA_FRIENDLY;
+        }, [&]( monster & critter ) {
             if( here->sees( critter.pos_bub( *here ), pos_bub( *here ), light ) ) {
                 // Anger trumps fear trumps ennui
                 if( critter.type->has_anger_trigger( mon_trigger::FRIEND_ATTACKED ) ) {
@@ -3955,7 +3953,7 @@ void monster::on_hit( map *here, Creature *source, bodypart_id,
                     critter.anger -= 15;
                 }
             }
-        }
+        } );
     }
     if( source != nullptr ) {
         if( Character *attacker = source->as_character() ) {
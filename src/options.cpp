@@ -2887,6 +2887,13 @@ void options_manager::add_options_debug()
 
     add_empty_line();
 
+    add( "THREADED_SHADOWCASTING", "debug", to_translation( "Multithreaded 3D vision" ),
+         to_translation( "If true, the vision and light casting across z-levels is split between worker threads.  Only has an effect on machines with more than one hardware thread." ),
+         false
+       );
+
+    add_empty_line();
+
     add( "WARN_ON_MODIFIED", "debug", to_translation( "Warn if file integrity check fails" ),
          to_translation( "This option controls whether the game will warn when it detects that the game's data has been modified." ),
          true );
@@ -4038,6 +4045,7 @@ void options_manager::update_options_cache()
     prevent_occlusion_min_dist = ::get_option<float>( "PREVENT_OCCLUSION_MIN_DIST" );
     prevent_occlusion_max_dist = ::get_option<float>( "PREVENT_OCCLUSION_MAX_DIST" );
     show_creature_overlay_icons = ::get_option<bool>( "CREATURE_OVERLAY_ICONS" );
+    threaded_shadowcasting = ::get_option<bool>( "THREADED_SHADOWCASTING" );
 
     // if the tilesets are identical don't duplicate
     use_far_tiles = ::get_option<bool>( "USE_DISTANT_TILES" ) ||
@@ -4507,9 +4507,11 @@ void mongroup::wander( const overmap &om )
 /**
  * Moves hordes around the map according to their behaviour and target.
  * Also, emerge hordes from monsters that are outside the player's view. Currently only works for zombies.
+ * Returns the hordes that walked onto a neighbouring overmap, the caller hands them over.
  */
-void overmap::move_hordes()
+std::vector<mongroup> overmap::move_hordes()
 {
+    std::vector<mongroup> left;
     // Prevent hordes to be moved twice by putting them in here after moving.
     decltype( zg ) tmpzg;
     //MOVE ZOMBIE GROUPS
@@ -4553,23 +4555,36 @@ void overmap::move_hordes()
         // frequently. The average horde speed for regular Z's is around 100,
         // or one space per 5 minutes.
         if( one_in( movement_chance ) && rng( 0, 100 ) < mg.interest && rng( 0, 200 ) < mg.avg_speed() ) {
-            // TODO: Handle moving to adjacent overmaps.
-            if( mg.abs_pos.x() > mg.target.x() ) {
-                mg.abs_pos.x()--;
+            tripoint_abs_sm next = mg.abs_pos;
+            if( next.x() > mg.target.x() ) {
+                next.x()--;
             }
-            if( mg.abs_pos.x() < mg.target.x() ) {
-                mg.abs_pos.x()++;
+            if( next.x() < mg.target.x() ) {
+                next.x()++;
             }
-            if( mg.abs_pos.y() > mg.target.y() ) {
-                mg.abs_pos.y()--;
+            if( next.y() > mg.target.y() ) {
+                next.y()--;
             }
-            if( mg.abs_pos.y() < mg.target.y() ) {
-                mg.abs_pos.y()++;
+            if( next.y() < mg.target.y() ) {
+                next.y()++;
             }
 
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.emplace( mg.rel_pos(), mg );
-            zg.erase( it++ );
+            const point_abs_om next_om = project_to<coords::om>( next.xy() );
+            if( next_om != pos() && !overmap_buffer.has( next_om ) ) {
+                // Nowhere to put it yet, wait at the border until that overmap gets loaded
+                ++it;
+                continue;
+            }
+            mg.abs_pos = next;
+
+            // Re-key the group at its new location, the node keeps its monsters where they are
+            auto node = zg.extract( it++ );
+            if( next_om == pos() ) {
+                node.key() = node.mapped().rel_pos();
+                tmpzg.insert( std::move( node ) );
+            } else {
+                left.push_back( std::move( node.mapped() ) );
+            }
         } else {
             ++it;
         }
@@ -4654,6 +4669,7 @@ void overmap::move_hordes()
             monster_map_it = monster_map.erase( monster_map_it );
         }
     }
+    return left;
 }
 
 /**
@@ -570,7 +570,7 @@ class overmap
 
         void signal_hordes( const tripoint_rel_sm &p, int sig_power );
         void process_mongroups();
-        void move_hordes();
+        std::vector<mongroup> move_hordes();
 
         //nemesis movement for "hunted" trait
         void signal_nemesis( const tripoint_abs_sm & );
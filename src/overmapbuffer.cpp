@@ -347,6 +347,32 @@ bool overmapbuffer::has( const point_abs_om &p )
     return get_existing( p ) != nullptr;
 }
 
+bool overmapbuffer::create_neighbor_ahead( const tripoint_abs_omt &center, int margin )
+{
+    point_abs_om om;
+    point_om_omt local;
+    std::tie( om, local ) = project_remain<coords::om>( center.xy() );
+    const point_rel_om dir( local.x() < margin ? -1 : local.x() >= OMAPX - margin ? 1 : 0,
+                            local.y() < margin ? -1 : local.y() >= OMAPY - margin ? 1 : 0 );
+    if( dir == point_rel_om::zero ) {
+        return false;
+    }
+    // The overmaps across the nearby edges first, then the one across the corner
+    for( const point_rel_om &offset : {
+             point_rel_om( dir.x(), 0 ), point_rel_om( 0, dir.y() ), dir
+         } ) {
+        if( offset == point_rel_om::zero ) {
+            continue;
+        }
+        const point_abs_om p = om + offset;
+        if( overmaps.count( p ) == 0 ) {
+            get( p );
+            return true;
+        }
+    }
+    return false;
+}
+
 overmap_with_local_coords
 overmapbuffer::get_om_global( const point_abs_omt &p )
 {
@@ -642,8 +668,17 @@ void overmapbuffer::move_hordes()
     // arbitrary radius to include nearby overmaps (aside from the current one)
     const int radius = MAPSIZE * 2;
     const tripoint_abs_sm center = get_player_character().pos_abs_sm();
+    std::vector<mongroup> crossed;
     for( overmap *&om : get_overmaps_near( center, radius ) ) {
-        om->move_hordes();
+        std::vector<mongroup> left = om->move_hordes();
+        crossed.insert( crossed.end(), std::make_move_iterator( left.begin() ),
+                        std::make_move_iterator( left.end() ) );
+    }
+    // Only handed over once every overmap has moved, so no horde gets a second step this turn
+    for( mongroup &mg : crossed ) {
+        overmap &dest = get( project_to<coords::om>( mg.abs_pos.xy() ) );
+        const tripoint_om_sm rel = mg.rel_pos();
+        dest.zg.emplace( rel, std::move( mg ) );
     }
 }
 
@@ -414,6 +414,14 @@ class overmapbuffer
          * the given coordinates.
          */
         bool has( const point_abs_om &p );
+        /**
+         * If center is within margin overmap terrains of an edge (or corner) of its
+         * overmap, loads or generates the overmap on the other side of it, so that is
+         * done ahead of time instead of when something first steps onto it.
+         * At most one overmap is created per call.
+         * @returns true if an overmap was created.
+         */
+        bool create_neighbor_ahead( const tripoint_abs_omt &center, int margin );
         /**
          * Get an existing overmap, does not create a new one
          * and may return NULL if the requested overmap does not
@@ -3,14 +3,16 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <climits>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <memory>
 #include <optional>
-#include <queue>
 #include <utility>
 #include <vector>
 
+#include "calendar.h"
 #include "cata_utility.h"
 #include "coordinates.h"
 #include "creature.h"
@@ -51,12 +53,72 @@ struct path_data_layer {
     }
 };
 
+// Distance from every tile of one z-level to a single target, built by a
+// Dijkstra search outward from the target. When many creatures with the same
+// settings chase the same target (e.g. a horde after the player), each of them
+// only needs to walk down the gradient instead of running its own search.
+struct pathfinding_distance_field {
+    static constexpr int unreachable = INT_MAX;
+
+    tripoint_bub_ms target;
+    int radius = 0;
+    pathfinding_settings settings;
+    uint64_t generation = 0;
+    time_point turn;
+    // How many routes asked for this field since it was keyed
+    int requests = 0;
+    bool built = false;
+
+    // Bounds of the searched area, inclusive
+    point_bub_ms min;
+    point_bub_ms max;
+    std::array<int, MAPSIZE_X *MAPSIZE_Y> dist;
+    // Index into neighbour offsets of the next step towards the target, or -1
+    std::array<int8_t, MAPSIZE_X *MAPSIZE_Y> next;
+
+    bool in_bounds( const point_bub_ms &p ) const {
+        return p.x() >= min.x() && p.x() <= max.x() && p.y() >= min.y() && p.y() <= max.y();
+    }
+};
+
+// 7 3 5
+// 1 . 2
+// 6 4 8
+static constexpr std::array<int, 8> x_offset{ { -1,  1,  0,  0,  1, -1, -1, 1 } };
+static constexpr std::array<int, 8> y_offset{ {  0,  0, -1,  1, -1,  1, -1, 1 } };
+
+// A route found by a previous search, along with everything it depended on.
+// Any tail of it is still a shortest path to the same target, so creatures
+// standing on it can reuse it instead of running a new search.
+struct cached_route {
+    tripoint_bub_ms from;
+    tripoint_bub_ms target;
+    int radius = -1;
+    pathfinding_settings settings;
+    int minz = 0;
+    int maxz = -1;
+    std::array<uint64_t, OVERMAP_LAYERS> generations = {};
+    std::vector<tripoint_bub_ms> route;
+};
+
 struct pathfinder {
-    using queue_type =
-        std::priority_queue< std::pair<int, tripoint_bub_ms>, std::vector< std::pair<int, tripoint_bub_ms> >, pair_greater_cmp_first >;
-    queue_type open;
+    using queue_entry = std::pair<int, tripoint_bub_ms>;
+    // Binary heap kept in a vector that is only cleared between searches,
+    // so that its storage gets reused
+    std::vector<queue_entry> open;
     std::array< std::unique_ptr< path_data_layer >, OVERMAP_LAYERS > path_data;
 
+    static constexpr size_t max_cached_routes = 16;
+    std::array<cached_route, max_cached_routes> cached_routes;
+    size_t next_cached_route = 0;
+
+    static constexpr size_t max_distance_fields = 4;
+    // Number of searches for the same target in a single turn after which
+    // building a distance field pays for itself
+    static constexpr int min_requests_for_field = 3;
+    std::array<std::unique_ptr<pathfinding_distance_field>, max_distance_fields> distance_fields;
+    size_t next_distance_field = 0;
+
     path_data_layer &get_layer( const int z ) {
         std::unique_ptr< path_data_layer > &ptr = path_data[z + OVERMAP_DEPTH];
         if( ptr != nullptr ) {
@@ -73,7 +135,7 @@ struct pathfinder {
                 path_data[i + OVERMAP_DEPTH]->reset();
             }
         }
-        open = queue_type();
+        open.clear();
     }
 
     bool empty() const {
@@ -81,9 +143,10 @@ struct pathfinder {
     }
 
     tripoint_bub_ms get_next() {
-        const auto pt = open.top();
-        open.pop();
-        return pt.second;
+        std::pop_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        const tripoint_bub_ms pt = open.back().second;
+        open.pop_back();
+        return pt;
     }
 
     void add_point( const int gscore, const int score, const tripoint_bub_ms &from,
@@ -101,7 +164,8 @@ struct pathfinder {
         layer.gscore[index] = gscore;
         layer.parent[index] = from;
         layer.score [index] = score;
-        open.emplace( score, to );
+        open.emplace_back( score, to );
+        std::push_heap( open.begin(), open.end(), pair_greater_cmp_first() );
     }
 
     void close_point( const tripoint_bub_ms &p ) {
@@ -115,6 +179,91 @@ struct pathfinder {
         const int index = flat_index( p.xy() );
         layer.closed[index] = false;
     }
+
+    // Returns the rest of a cached route from `f` to `target`, if one is still valid.
+    std::optional<std::vector<tripoint_bub_ms>> find_cached_route( const map &m,
+            const tripoint_bub_ms &f, const pathfinding_target &target,
+            const pathfinding_settings &settings,
+            const std::function<bool( const tripoint_bub_ms & )> &avoid ) {
+        for( cached_route &cached : cached_routes ) {
+            if( cached.route.empty() || cached.target != target.center ||
+                cached.radius != target.r || cached.settings != settings ||
+                f.z() < cached.minz || f.z() > cached.maxz ) {
+                continue;
+            }
+            bool valid = true;
+            for( int z = cached.minz; z <= cached.maxz; ++z ) {
+                if( m.get_pathfinding_cache_ref( z ).generation != cached.generations[z + OVERMAP_DEPTH] ) {
+                    valid = false;
+                    break;
+                }
+            }
+            if( !valid ) {
+                // Terrain changed under it, it will never be valid again
+                cached.route.clear();
+                continue;
+            }
+            std::vector<tripoint_bub_ms>::const_iterator start = cached.route.begin();
+            if( f != cached.from ) {
+                start = std::find( cached.route.begin(), cached.route.end(), f );
+                if( start == cached.route.end() || ++start == cached.route.end() ) {
+                    continue;
+                }
+            }
+            // Creatures and other transient obstacles aren't part of the cache
+            if( std::any_of( start, cached.route.cend(), [&]( const tripoint_bub_ms & p ) {
+            return !target.contains( p ) && avoid( p );
+            } ) ) {
+                continue;
+            }
+            return std::vector<tripoint_bub_ms>( start, cached.route.cend() );
+        }
+        return std::nullopt;
+    }
+
+    // Notes that a route to `target` was requested and returns the distance field for it
+    // once enough of them were requested this turn. The field may not be built yet.
+    pathfinding_distance_field *request_distance_field( const pathfinding_target &target,
+            const pathfinding_settings &settings, uint64_t generation ) {
+        for( std::unique_ptr<pathfinding_distance_field> &field : distance_fields ) {
+            if( field != nullptr && field->target == target.center && field->radius == target.r &&
+                field->generation == generation && field->turn == calendar::turn &&
+                field->settings == settings ) {
+                ++field->requests;
+                return field->requests >= min_requests_for_field ? field.get() : nullptr;
+            }
+        }
+        std::unique_ptr<pathfinding_distance_field> &field = distance_fields[next_distance_field];
+        next_distance_field = ( next_distance_field + 1 ) % max_distance_fields;
+        if( field == nullptr ) {
+            field = std::make_unique<pathfinding_distance_field>();
+        }
+        field->target = target.center;
+        field->radius = target.r;
+        field->settings = settings;
+        field->generation = generation;
+        field->turn = calendar::turn;
+        field->requests = 1;
+        field->built = false;
+        return nullptr;
+    }
+
+    void cache_route( const map &m, const tripoint_bub_ms &f, const pathfinding_target &target,
+                      const pathfinding_settings &settings, int minz, int maxz,
+                      const std::vector<tripoint_bub_ms> &route ) {
+        cached_route &cached = cached_routes[next_cached_route];
+        next_cached_route = ( next_cached_route + 1 ) % max_cached_routes;
+        cached.from = f;
+        cached.target = target.center;
+        cached.radius = target.r;
+        cached.settings = settings;
+        cached.minz = minz;
+        cached.maxz = maxz;
+        for( int z = minz; z <= maxz; ++z ) {
+            cached.generations[z + OVERMAP_DEPTH] = m.get_pathfinding_cache_ref( z ).generation;
+        }
+        cached.route = route;
+    }
 };
 
 static pathfinder pf;
@@ -380,6 +529,120 @@ int map::extra_cost( const tripoint_bub_ms &cur, const tripoint_bub_ms &p,
     return pass_cost + avoid_cost;
 }
 
+void map::build_distance_field( pathfinding_distance_field &field ) const
+{
+    const pathfinding_settings &settings = field.settings;
+    const int z = field.target.z();
+    const int pad = 16;
+    const int reach = settings.max_dist + field.radius + pad;
+    int min_x = field.target.x() - reach;
+    int min_y = field.target.y() - reach;
+    int max_x = field.target.x() + reach;
+    int max_y = field.target.y() + reach;
+    int dummy_z = z;
+    clip_to_bounds( min_x, min_y, dummy_z );
+    clip_to_bounds( max_x, max_y, dummy_z );
+    field.min = point_bub_ms( min_x, min_y );
+    field.max = point_bub_ms( max_x, max_y );
+    field.dist.fill( pathfinding_distance_field::unreachable );
+    field.next.fill( -1 );
+
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( z );
+    const pathfinding_target target{ field.target, field.radius };
+
+    // Reuse the A* queue, the search state isn't needed between calls
+    pf.open.clear();
+    for( int x = min_x; x <= max_x; ++x ) {
+        for( int y = min_y; y <= max_y; ++y ) {
+            const tripoint_bub_ms p( x, y, z );
+            if( target.contains( p ) ) {
+                field.dist[flat_index( p.xy() )] = 0;
+                pf.open.emplace_back( 0, p );
+            }
+        }
+    }
+    std::make_heap( pf.open.begin(), pf.open.end(), pair_greater_cmp_first() );
+
+    while( !pf.open.empty() ) {
+        std::pop_heap( pf.open.begin(), pf.open.end(), pair_greater_cmp_first() );
+        const auto [d, q] = pf.open.back();
+        pf.open.pop_back();
+        if( d > field.dist[flat_index( q.xy() )] || d > settings.max_length ) {
+            continue;
+        }
+
+        const PathfindingFlags q_special = pf_cache.special[q.xy()];
+        // Ledges are avoided by climbing down, which this single z-level search can't
+        // represent. Leave them to the regular search.
+        if( settings.avoid_traps && ( q_special & PathfindingFlag::DangerousTrap ) ) {
+            const const_maptile &tile = maptile_at_internal( q );
+            const ter_t &terrain = tile.get_ter_t();
+            const trap &ter_trp = terrain.trap.obj();
+            const trap &trp = ter_trp.is_benign() ? tile.get_trap_t() : ter_trp;
+            if( !trp.is_benign() && terrain.has_flag( ter_furn_flag::TFLAG_NO_FLOOR ) &&
+                !target.contains( q ) ) {
+                continue;
+            }
+        }
+
+        for( size_t i = 0; i < 8; i++ ) {
+            // Moving from p into q
+            const tripoint_bub_ms p( q.x() - x_offset[i], q.y() - y_offset[i], z );
+            if( !field.in_bounds( p.xy() ) ) {
+                continue;
+            }
+            const int cost = extra_cost( p, q, settings, q_special );
+            if( cost < 0 ) {
+                continue;
+            }
+            const int newd = d + cost + ( ( x_offset[i] != 0 && y_offset[i] != 0 ) ? 1 : 0 );
+            const int index = flat_index( p.xy() );
+            if( newd < field.dist[index] ) {
+                field.dist[index] = newd;
+                field.next[index] = static_cast<int8_t>( i );
+                pf.open.emplace_back( newd, p );
+                std::push_heap( pf.open.begin(), pf.open.end(), pair_greater_cmp_first() );
+            }
+        }
+    }
+    field.built = true;
+}
+
+// Follows the gradient of |field| from |f|. Returns nothing if the field can't
+// be used from there, so that the caller falls back to a regular search.
+static std::optional<std::vector<tripoint_bub_ms>> route_from_distance_field(
+            const pathfinding_distance_field &field, const tripoint_bub_ms &f,
+            const pathfinding_target &target,
+            const std::function<bool( const tripoint_bub_ms & )> &avoid )
+{
+    if( !field.in_bounds( f.xy() ) ) {
+        return std::nullopt;
+    }
+    const int start_dist = field.dist[flat_index( f.xy() )];
+    if( start_dist == pathfinding_distance_field::unreachable ) {
+        // Might still be reachable using stairs or ramps
+        return std::nullopt;
+    }
+    if( start_dist > field.settings.max_length ) {
+        return std::vector<tripoint_bub_ms>();
+    }
+    std::vector<tripoint_bub_ms> ret;
+    tripoint_bub_ms cur = f;
+    while( !target.contains( cur ) ) {
+        const int8_t dir = field.next[flat_index( cur.xy() )];
+        if( dir < 0 || ret.size() > static_cast<size_t>( start_dist ) ) {
+            return std::nullopt;
+        }
+        const tripoint_bub_ms p( cur.x() + x_offset[dir], cur.y() + y_offset[dir], cur.z() );
+        if( !target.contains( p ) && avoid( p ) ) {
+            return std::nullopt;
+        }
+        ret.push_back( p );
+        cur = p;
+    }
+    return ret;
+}
+
 std::vector<tripoint_bub_ms> map::route( const Creature &who,
         const pathfinding_target &target ) const
 {
@@ -435,6 +698,25 @@ std::vector<tripoint_bub_ms> map::route( const tripoint_bub_ms &f,
         return ret;
     }
 
+    if( std::optional<std::vector<tripoint_bub_ms>> cached = pf.find_cached_route( *this, f, target,
+            settings, avoid ) ) {
+        return *std::move( cached );
+    }
+
+    if( f.z() == t.z() ) {
+        pathfinding_distance_field *field = pf.request_distance_field( target, settings,
+                                            get_pathfinding_cache_ref( t.z() ).generation );
+        if( field != nullptr ) {
+            if( !field->built ) {
+                build_distance_field( *field );
+            }
+            if( std::optional<std::vector<tripoint_bub_ms>> field_route = route_from_distance_field( *field,
+                    f, target, avoid ) ) {
+                return *std::move( field_route );
+            }
+        }
+    }
+
     const int max_length = settings.max_length;
 
     const int pad = 16;  // Should be much bigger - low value makes pathfinders dumb!
@@ -477,11 +759,6 @@ std::vector<tripoint_bub_ms> map::route( const tripoint_bub_ms &f,
         const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( cur.z() );
         const PathfindingFlags cur_special = pf_cache.special[cur.x()][cur.y()];
 
-        // 7 3 5
-        // 1 . 2
-        // 6 4 8
-        constexpr std::array<int, 8> x_offset{ { -1,  1,  0,  0,  1, -1, -1, 1 } };
-        constexpr std::array<int, 8> y_offset{ {  0,  0, -1,  1, -1,  1, -1, 1 } };
         for( size_t i = 0; i < 8; i++ ) {
             const tripoint_bub_ms p( cur.x() + x_offset[i], cur.y() + y_offset[i], cur.z() );
             const int index = flat_index( p.xy() );
@@ -657,11 +934,22 @@ std::vector<tripoint_bub_ms> map::route( const tripoint_bub_ms &f,
         }
 
         std::reverse( ret.begin(), ret.end() );
+        pf.cache_route( *this, f, target, settings, min.z(), max.z(), ret );
     }
 
     return ret;
 }
 
+bool pathfinding_settings::operator==( const pathfinding_settings &rhs ) const
+{
+    return bash_strength == rhs.bash_strength && max_dist == rhs.max_dist &&
+           max_length == rhs.max_length && climb_cost == rhs.climb_cost &&
+           allow_open_doors == rhs.allow_open_doors && allow_unlock_doors == rhs.allow_unlock_doors &&
+           avoid_traps == rhs.avoid_traps && allow_climb_stairs == rhs.allow_climb_stairs &&
+           avoid_rough_terrain == rhs.avoid_rough_terrain && avoid_sharp == rhs.avoid_sharp &&
+           avoid_dangerous_fields == rhs.avoid_dangerous_fields && size == rhs.size;
+}
+
 bool pathfinding_target::contains( const tripoint_bub_ms &p ) const
 {
     if( r == 0 ) {
@@ -86,6 +86,13 @@ class PathfindingFlags
             return is_any_set();
         }
 
+        constexpr bool operator==( PathfindingFlags flags ) const {
+            return flags_ == flags.flags_;
+        }
+        constexpr bool operator!=( PathfindingFlags flags ) const {
+            return flags_ != flags.flags_;
+        }
+
         constexpr PathfindingFlags &operator|=( PathfindingFlags flags ) {
             set_union( flags );
             return *this;
@@ -130,6 +137,9 @@ struct pathfinding_cache {
 
     bool dirty = false;
     std::unordered_set<point_bub_ms> dirty_points;
+    // Changes whenever a tile is marked dirty or the cache is rebuilt; routes cached by
+    // the pathfinder remember it to detect that they may have become invalid.
+    uint64_t generation = 0;
 
     cata::mdarray<PathfindingFlags, point_bub_ms> special;
 };
@@ -164,6 +174,11 @@ struct pathfinding_settings {
           avoid_rough_terrain( art ), avoid_sharp( as ), size( sz )  {}
 
     pathfinding_settings &operator=( const pathfinding_settings & ) = default;
+
+    bool operator==( const pathfinding_settings &rhs ) const;
+    bool operator!=( const pathfinding_settings &rhs ) const {
+        return !( *this == rhs );
+    }
 };
 
 struct pathfinding_target {
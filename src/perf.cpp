@@ -1,5 +1,11 @@
 #include "perf.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "json.h"
+
 cata_timer::timers_map &cata_timer::top_level_timer_map()
 {
     static cata_timer::timers_map map;
@@ -11,3 +17,174 @@ std::vector<cata_timer::timers_map::iterator> &cata_timer::timer_stack()
     static std::vector<cata_timer::timers_map::iterator> stack;
     return stack;
 }
+
+turn_profiler::turn_profiler() : epoch( std::chrono::steady_clock::now() ), turns( max_turns ) {}
+
+turn_profiler &turn_profiler::get()
+{
+    static turn_profiler profiler;
+    return profiler;
+}
+
+int64_t turn_profiler::now_us() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - epoch ).count();
+}
+
+void turn_profiler::set_enabled( bool enable )
+{
+    is_enabled = enable;
+}
+
+void turn_profiler::clear()
+{
+    first_turn = 0;
+    num_turns = 0;
+}
+
+bool turn_profiler::begin_turn( int turn )
+{
+    if( in_turn ) {
+        return false;
+    }
+    in_turn = true;
+    current.turn = turn;
+    current.start_us = now_us();
+    current.duration_us = 0;
+    current.events.clear();
+    open_events.clear();
+    return true;
+}
+
+void turn_profiler::end_turn()
+{
+    if( !in_turn ) {
+        return;
+    }
+    in_turn = false;
+    current.duration_us = now_us() - current.start_us;
+    if( num_turns < max_turns ) {
+        std::swap( turns[( first_turn + num_turns ) % max_turns], current );
+        ++num_turns;
+    } else {
+        std::swap( turns[first_turn], current );
+        first_turn = ( first_turn + 1 ) % max_turns;
+    }
+}
+
+int turn_profiler::open_scope( const char *name )
+{
+    if( !in_turn ) {
+        return -1;
+    }
+    const int index = static_cast<int>( current.events.size() );
+    current.events.push_back( { name, static_cast<int>( open_events.size() ),
+                                now_us() - current.start_us, 0 } );
+    open_events.push_back( index );
+    return index;
+}
+
+void turn_profiler::close_scope( int index )
+{
+    // The turn may have ended (or a new one started) while the scope was open
+    if( !in_turn || open_events.empty() || open_events.back() != index ) {
+        return;
+    }
+    event &ev = current.events[index];
+    ev.duration_us = now_us() - current.start_us - ev.start_us;
+    open_events.pop_back();
+}
+
+std::string turn_profiler::summary() const
+{
+    if( num_turns == 0 ) {
+        return "No turns recorded.\n";
+    }
+    struct phase_stats {
+        std::string name;
+        int depth = 0;
+        int64_t total_us = 0;
+        int64_t max_us = 0;
+    };
+    // Phases are told apart by their whole path, so the same function called from
+    // two places shows up twice. Kept in the order they were first seen.
+    std::vector<phase_stats> phases;
+    std::map<std::string, size_t> phase_index;
+    int64_t total_turn_us = 0;
+    int64_t max_turn_us = 0;
+    for( size_t i = 0; i < num_turns; ++i ) {
+        const turn_record &turn = recorded_turn( i );
+        total_turn_us += turn.duration_us;
+        max_turn_us = std::max( max_turn_us, turn.duration_us );
+        std::vector<std::string> path;
+        std::map<size_t, int64_t> this_turn;
+        for( const event &ev : turn.events ) {
+            path.resize( ev.depth );
+            path.emplace_back( ( path.empty() ? "" : path.back() + "/" ) + ev.name );
+            auto it = phase_index.find( path.back() );
+            if( it == phase_index.end() ) {
+                it = phase_index.emplace( path.back(), phases.size() ).first;
+                phases.push_back( { ev.name, ev.depth } );
+            }
+            this_turn[it->second] += ev.duration_us;
+        }
+        for( const std::pair<const size_t, int64_t> &phase : this_turn ) {
+            phases[phase.first].total_us += phase.second;
+            phases[phase.first].max_us = std::max( phases[phase.first].max_us, phase.second );
+        }
+    }
+
+    const int64_t turn_count = static_cast<int64_t>( num_turns );
+    const int64_t avg_turn_us = total_turn_us / turn_count;
+    std::ostringstream out;
+    out << "Turns " << recorded_turn( 0 ).turn << " to " << recorded_turn( num_turns - 1 ).turn
+        << " (" << turn_count << " recorded)\n";
+    out << "Times in microseconds, averaged over all recorded turns.\n\n";
+    out << std::left << std::setw( 32 ) << "phase" << std::right << std::setw( 10 ) << "avg"
+        << std::setw( 10 ) << "max" << "  share\n";
+    out << std::left << std::setw( 32 ) << "turn" << std::right << std::setw( 10 ) << avg_turn_us
+        << std::setw( 10 ) << max_turn_us << '\n';
+    for( const phase_stats &phase : phases ) {
+        const int64_t avg_us = phase.total_us / turn_count;
+        const int bar = total_turn_us > 0 ?
+                        static_cast<int>( 20 * phase.total_us / total_turn_us ) : 0;
+        const std::string indent( 2 * ( phase.depth + 1 ), ' ' );
+        out << std::left << std::setw( 32 ) << indent + phase.name << std::right << std::setw( 10 ) << avg_us << std::setw( 10 ) << phase.max_us << "  "
+            << std::string( bar, '#' ) << '\n';
+    }
+    return out.str();
+}
+
+void turn_profiler::write_chrome_trace( std::ostream &out ) const
+{
+    JsonOut jsout( out );
+    jsout.start_object();
+    jsout.member( "displayTimeUnit", "ms" );
+    jsout.member( "traceEvents" );
+    jsout.start_array();
+    const auto write_event = [&jsout]( const std::string & name, int64_t start_us,
+    int64_t duration_us, int turn ) {
+        jsout.start_object();
+        jsout.member( "name", name );
+        jsout.member( "ph", "X" );
+        jsout.member( "ts", start_us );
+        jsout.member( "dur", duration_us );
+        jsout.member( "pid", 1 );
+        jsout.member( "tid", 1 );
+        jsout.member( "args" );
+        jsout.start_object();
+        jsout.member( "turn", turn );
+        jsout.end_object();
+        jsout.end_object();
+    };
+    for( size_t i = 0; i < num_turns; ++i ) {
+        const turn_record &turn = recorded_turn( i );
+        write_event( "turn", turn.start_us, turn.duration_us, turn.turn );
+        for( const event &ev : turn.events ) {
+            write_event( ev.name, turn.start_us + ev.start_us, ev.duration_us, turn.turn );
+        }
+    }
+    jsout.end_array();
+    jsout.end_object();
+}
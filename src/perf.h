@@ -5,6 +5,7 @@
 #include <stdint.h>
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -80,4 +81,117 @@ struct cata_timer {
         static std::vector<timers_map::iterator> &timer_stack();
 };
 
+/**
+ * Timings of the phases of recent turns, for finding out which one got slow.
+ *
+ * Turns are delimited by a turn_profile_turn and the phases inside them by
+ * turn_profile_scope. Nothing is recorded unless the profiler was enabled
+ * (from the debug menu), and while disabled a scope costs a single branch.
+ * The last max_turns turns are kept in storage that is reused once it has
+ * been filled, so recording doesn't allocate from turn to turn.
+ */
+class turn_profiler
+{
+    public:
+        struct event {
+            // Has to outlive the profiler, normally a string literal
+            const char *name;
+            int depth;
+            // Relative to the start of the turn
+            int64_t start_us;
+            int64_t duration_us;
+        };
+        struct turn_record {
+            int turn;
+            // Relative to the creation of the profiler
+            int64_t start_us;
+            int64_t duration_us;
+            std::vector<event> events;
+        };
+
+        static constexpr size_t max_turns = 300;
+
+        static turn_profiler &get();
+
+        bool enabled() const {
+            return is_enabled;
+        }
+        void set_enabled( bool enable );
+        void clear();
+
+        /** Returns false if nothing will be recorded for this turn. */
+        bool begin_turn( int turn );
+        void end_turn();
+        /** Returns the index to pass to close_scope, or -1 if not recording. */
+        int open_scope( const char *name );
+        void close_scope( int index );
+
+        size_t num_recorded_turns() const {
+            return num_turns;
+        }
+        /** The i-th of the recorded turns, oldest first. */
+        const turn_record &recorded_turn( size_t i ) const {
+            return turns[( first_turn + i ) % max_turns];
+        }
+        /** Average and worst time of every phase, indented by nesting. */
+        std::string summary() const;
+        /** Writes the recorded turns in the Chrome trace event format. */
+        void write_chrome_trace( std::ostream &out ) const;
+
+    private:
+        turn_profiler();
+        int64_t now_us() const;
+
+        bool is_enabled = false;
+        bool in_turn = false;
+        std::chrono::steady_clock::time_point epoch;
+        turn_record current;
+        std::vector<int> open_events;
+        // Ring of max_turns records, the oldest at first_turn. Finished turns are
+        // swapped in, so the events vectors keep their capacity.
+        std::vector<turn_record> turns;
+        size_t first_turn = 0;
+        size_t num_turns = 0;
+};
+
+/** Records the enclosed block as one phase of the current turn. */
+class turn_profile_scope
+{
+    public:
+        explicit turn_profile_scope( const char *name ) {
+            turn_profiler &profiler = turn_profiler::get();
+            if( profiler.enabled() ) {
+                index = profiler.open_scope( name );
+            }
+        }
+        ~turn_profile_scope() {
+            if( index >= 0 ) {
+                turn_profiler::get().close_scope( index );
+            }
+        }
+        turn_profile_scope( const turn_profile_scope & ) = delete;
+        turn_profile_scope &operator=( const turn_profile_scope & ) = delete;
+    private:
+        int index = -1;
+};
+
+/** Marks the enclosed block as one turn for the turn_profiler. */
+class turn_profile_turn
+{
+    public:
+        explicit turn_profile_turn( int turn ) {
+            turn_profiler &profiler = turn_profiler::get();
+            recording = profiler.enabled() && profiler.begin_turn( turn );
+        }
+        ~turn_profile_turn() {
+            if( recording ) {
+                turn_profiler::get().end_turn();
+            }
+        }
+        turn_profile_turn( const turn_profile_turn & ) = delete;
+        turn_profile_turn &operator=( const turn_profile_turn & ) = delete;
+    private:
+        bool recording = false;
+};
+
 #endif // CATA_SRC_PERF_H
@@ -332,6 +332,7 @@ void scent_map::deserialize( const std::string &data, bool is_type )
                 val = stmp;
             }
         }
+        recalculate_scented_area();
     }
 }
 
@@ -1828,7 +1829,7 @@ void faction_manager::deserialize( const JsonValue &jv )
 void creature_tracker::deserialize( const JsonArray &ja )
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_locations();
     for( JsonValue jv : ja ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
         shared_ptr_fast<monster> mptr = make_shared_fast<monster>();
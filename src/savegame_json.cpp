@@ -2886,15 +2886,16 @@ void item::io( Archive &archive )
     archive.io( "energy", energy, 0_mJ );
 
     int cur_phase = static_cast<int>( current_phase );
+    rare_data rare = get_rare_data();
     archive.io( "burnt", burnt, 0 );
     archive.io( "poison", poison, 0 );
-    archive.io( "frequency", frequency, 0 );
-    archive.io( "snip_id", snip_id, snippet_id::NULL_ID() );
+    archive.io( "frequency", rare.frequency, 0 );
+    archive.io( "snip_id", rare.snip_id, snippet_id::NULL_ID() );
     // NB! field is named `irridation` in legacy files
     archive.io( "irridation", irradiation, 0 );
     archive.io( "bday", bday, calendar::start_of_cataclysm );
-    archive.io( "mission_id", mission_id, -1 );
-    archive.io( "player_id", player_id, -1 );
+    archive.io( "mission_id", rare.mission_id, -1 );
+    archive.io( "player_id", rare.player_id, -1 );
     // item variables
     archive.io( "item_vars", item_vars, io::empty_default_tag() );
 
@@ -2923,7 +2924,7 @@ void item::io( Archive &archive )
     }
 
     // TODO: change default to empty string
-    archive.io( "name", corpse_name, std::string() );
+    archive.io( "name", rare.corpse_name, std::string() );
     archive.io( "owner", owner, faction_id::NULL_ID() );
     archive.io( "old_owner", old_owner, faction_id::NULL_ID() );
     archive.io( "invlet", invlet, '\0' );
@@ -2934,7 +2935,7 @@ void item::io( Archive &archive )
     archive.io( "item_counter", item_counter, static_cast<decltype( item_counter )>( 0 ) );
     archive.io( "countdown_point", countdown_point, calendar::turn_max );
     archive.io( "wetness", wetness, 0 );
-    archive.io( "dropped_from", dropped_from, harvest_drop_type_id::NULL_ID() );
+    archive.io( "dropped_from", rare.dropped_from, harvest_drop_type_id::NULL_ID() );
     archive.io( "rot", rot, 0_turns );
     archive.io( "last_temp_check", last_temp_check, calendar::start_of_cataclysm );
     archive.io( "current_phase", cur_phase, static_cast<int>( type->phase ) );
@@ -2980,6 +2981,10 @@ void item::io( Archive &archive )
         }
     }
 
+    if( Archive::is_input::value ) {
+        rare_data_ = rare.is_empty() ? nullptr : cata::make_value<rare_data>( std::move( rare ) );
+    }
+
     item_controller->migrate_item( orig, *this );
 
     if( !Archive::is_input::value ) {
@@ -2997,8 +3002,10 @@ void item::io( Archive &archive )
     if( poison != 0 && note == 0 && !type->snippet_category.empty() ) {
         std::swap( note, poison );
     }
-    if( poison != 0 && frequency == 0 && ( typeId() == itype_radio_on || typeId() == itype_radio ) ) {
-        std::swap( frequency, poison );
+    if( poison != 0 && get_frequency() == 0 && ( typeId() == itype_radio_on ||
+            typeId() == itype_radio ) ) {
+        set_frequency( poison );
+        poison = 0;
     }
     if( poison != 0 && irradiation == 0 && typeId() == itype_rad_badge ) {
         std::swap( irradiation, poison );
@@ -3019,11 +3026,11 @@ void item::io( Archive &archive )
     } );
 
     if( note_read ) {
-        snip_id = SNIPPET.migrate_hash_to_id( note );
+        get_rare_data_for_writing().snip_id = SNIPPET.migrate_hash_to_id( note );
     } else {
         std::optional<std::string> snip;
         if( archive.read( "snippet_id", snip ) && snip ) {
-            snip_id = snippet_id( snip.value() );
+            get_rare_data_for_writing().snip_id = snippet_id( snip.value() );
         }
     }
 
@@ -4021,7 +4028,7 @@ void player_morale::load( const JsonObject &jsin )
     jsin.read( "morale", points );
 }
 
-void mm_submap::serialize( JsonOut &jsout ) const
+void mm_submap::serialize( JsonOut &jsout, mm_region_ids &ids ) const
 {
     jsout.start_array();
 
@@ -4034,11 +4041,11 @@ void mm_submap::serialize( JsonOut &jsout ) const
         jsout.start_array();
         jsout.write( num_same );
         jsout.write( static_cast<int>( last.symbol ) );
-        jsout.write( last.ter_id );
+        jsout.write( ids.index_of_ter( last.ter_id ) );
         jsout.write( static_cast<int>( last.ter_subtile ) );
         jsout.write( static_cast<int>( last.ter_rotation ) );
-        if( !last.get_dec_id().empty() ) {
-            jsout.write( last.dec_id );
+        if( last.dec_id != 0 ) {
+            jsout.write( ids.index_of_dec( last ) );
             jsout.write( static_cast<int>( last.dec_subtile ) );
             jsout.write( static_cast<int>( last.dec_rotation ) );
         }
@@ -4066,7 +4073,7 @@ void mm_submap::serialize( JsonOut &jsout ) const
     jsout.end_array();
 }
 
-void mm_submap::deserialize( int version, const JsonArray &ja )
+void mm_submap::deserialize( int version, const JsonArray &ja, mm_region_ids &ids )
 {
     size_t submap_array_idx = 0;
 
@@ -4096,7 +4103,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.set_dec_id( std::move( id ) );
                         tile.set_dec_subtile( ja_tile.get_int( 1 ) );
                         const int legacy_rotation = ja_tile.get_int( 2 );
-                        if( string_starts_with( tile.dec_id, "vp_" ) ) {
+                        if( string_starts_with( tile.get_dec_id(), "vp_" ) ) {
                             // legacy vehicle rotation needs to be converted from 0-360 degrees
                             // to 0-3 tileset rotation
                             const units::angle legacy_angle = units::from_degrees( legacy_rotation );
@@ -4109,7 +4116,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                     if( ja_tile.size() > 4 ) {
                         remaining = ja_tile.get_int( 4 ) - 1;
                     }
-                } else {
+                } else if( version < 2 ) { // ids written out in full for every tile
                     remaining = ja_tile.get_int( 0 ) - 1;
                     tile.symbol = ja_tile.get_int( 1 );
                     tile.set_ter_id( ja_tile.get_string( 2 ) );
@@ -4124,6 +4131,21 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.dec_subtile = 0;
                         tile.dec_rotation = 0;
                     }
+                } else {
+                    remaining = ja_tile.get_int( 0 ) - 1;
+                    tile.symbol = ja_tile.get_int( 1 );
+                    tile.ter_id = ids.ter_at( ja_tile, 2 );
+                    tile.ter_subtile = ja_tile.get_int( 3 );
+                    tile.ter_rotation = ja_tile.get_int( 4 );
+                    if( ja_tile.size() > 5 ) {
+                        tile.dec_id = ids.dec_at( ja_tile, 5 );
+                        tile.dec_subtile = ja_tile.get_int( 6 );
+                        tile.dec_rotation = ja_tile.get_int( 7 );
+                    } else {
+                        tile.dec_id = 0;
+                        tile.dec_subtile = 0;
+                        tile.dec_rotation = 0;
+                    }
                 }
             }
             // Try to avoid assigning to save up on memory
@@ -4136,8 +4158,9 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
 
 void mm_region::serialize( JsonOut &jsout ) const
 {
+    mm_region_ids ids;
     jsout.start_object();
-    jsout.member( "version", 1 );
+    jsout.member( "version", 2 );
     jsout.write( "data" );
     jsout.write_member_separator();
     jsout.start_array();
@@ -4148,16 +4171,20 @@ void mm_region::serialize( JsonOut &jsout ) const
             if( sm->is_empty() ) {
                 jsout.write_null();
             } else {
-                sm->serialize( jsout );
+                sm->serialize( jsout, ids );
             }
         }
     }
     jsout.end_array();
+    // Tiles in "data" refer to ids by their index in this list, which is only
+    // complete once all submaps have been written.
+    jsout.member( "ids", ids.ids );
     jsout.end_object();
 }
 
 void mm_region::deserialize( const JsonValue &ja )
 {
+    mm_region_ids ids;
     int version;
     JsonArray region_json;
 
@@ -4168,6 +4195,9 @@ void mm_region::deserialize( const JsonValue &ja )
         JsonObject region_obj = ja;
         version = region_obj.get_int( "version" );
         region_json = region_obj.get_array( "data" );
+        if( version >= 2 ) {
+            region_obj.read( "ids", ids.ids, true );
+        }
     }
 
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
@@ -4177,7 +4207,7 @@ void mm_region::deserialize( const JsonValue &ja )
             sm = make_shared_fast<mm_submap>();
             const JsonValue jsin = region_json.next_value();
             if( !jsin.test_null() ) {
-                sm->deserialize( version, jsin );
+                sm->deserialize( version, jsin, ids );
             }
         }
     }
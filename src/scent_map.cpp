@@ -53,14 +53,63 @@ void scent_map::reset()
             val = 0;
         }
     }
+    scented_area = half_open_rectangle<point_bub_ms>();
     typescent = scenttype_id();
 }
 
 void scent_map::decay()
 {
-    for( auto &elem : grscent ) {
-        for( int &val : elem ) {
-            val = std::max( 0, val - 1 );
+    // Shrink the scented area to whatever is still left afterwards
+    point new_min( MAPSIZE_X, MAPSIZE_Y );
+    point new_max;
+    for( int x = scented_area.p_min.x(); x < scented_area.p_max.x(); ++x ) {
+        std::array<int, MAPSIZE_Y> &column = grscent[x];
+        int left = 0;
+        for( int y = scented_area.p_min.y(); y < scented_area.p_max.y(); ++y ) {
+            column[y] = std::max( 0, column[y] - 1 );
+            left |= column[y];
+        }
+        if( left == 0 ) {
+            continue;
+        }
+        int first = scented_area.p_min.y();
+        while( column[first] == 0 ) {
+            ++first;
+        }
+        int last = scented_area.p_max.y() - 1;
+        while( column[last] == 0 ) {
+            --last;
+        }
+        new_min = point( std::min( new_min.x, x ), std::min( new_min.y, first ) );
+        new_max = point( x + 1, std::max( new_max.y, last + 1 ) );
+    }
+    if( new_max.x > new_min.x ) {
+        scented_area = { point_bub_ms( new_min ), point_bub_ms( new_max ) };
+    } else {
+        scented_area = half_open_rectangle<point_bub_ms>();
+    }
+}
+
+void scent_map::add_to_scented_area( const point_bub_ms &p )
+{
+    if( scented_area.p_min.x() >= scented_area.p_max.x() ) {
+        scented_area = { p, p + point( 1, 1 ) };
+        return;
+    }
+    scented_area.p_min = point_bub_ms( std::min( scented_area.p_min.x(), p.x() ),
+                                       std::min( scented_area.p_min.y(), p.y() ) );
+    scented_area.p_max = point_bub_ms( std::max( scented_area.p_max.x(), p.x() + 1 ),
+                                       std::max( scented_area.p_max.y(), p.y() + 1 ) );
+}
+
+void scent_map::recalculate_scented_area()
+{
+    scented_area = half_open_rectangle<point_bub_ms>();
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            if( grscent[x][y] != 0 ) {
+                add_to_scented_area( point_bub_ms( x, y ) );
+            }
         }
     }
 }
@@ -95,6 +144,20 @@ void scent_map::shift( const point_rel_ms &sm_shift )
             grscent[x][y] = inbounds( p ) ? grscent[p.x()][p.y()] : 0;
         }
     }
+
+    if( scented_area.p_min.x() < scented_area.p_max.x() ) {
+        const point_bub_ms shifted_min = scented_area.p_min - sm_shift;
+        const point_bub_ms shifted_max = scented_area.p_max - sm_shift;
+        scented_area = {
+            point_bub_ms( std::max( shifted_min.x(), 0 ), std::max( shifted_min.y(), 0 ) ),
+            point_bub_ms( std::min( shifted_max.x(), MAPSIZE_X ),
+                          std::min( shifted_max.y(), MAPSIZE_Y ) )
+        };
+        if( scented_area.p_min.x() >= scented_area.p_max.x() ||
+            scented_area.p_min.y() >= scented_area.p_max.y() ) {
+            scented_area = half_open_rectangle<point_bub_ms>();
+        }
+    }
 }
 
 int scent_map::get( const tripoint_bub_ms &p ) const
@@ -115,6 +178,9 @@ void scent_map::set( const tripoint_bub_ms &p, int value, const scenttype_id &ty
 void scent_map::set_unsafe( const tripoint_bub_ms &p, int value, const scenttype_id &type )
 {
     grscent[p.x()][p.y()] = value;
+    if( value != 0 ) {
+        add_to_scented_area( p.xy() );
+    }
     if( !type.is_empty() ) {
         typescent = type;
     }
@@ -177,93 +243,87 @@ void scent_map::update( const tripoint_bub_ms &center, map &m )
         return;
     }
 
-    // note: the next four intermediate matrices need to be at least
-    // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1] in size to hold enough data
-    // The code I'm modifying used [MAPSIZE_X]. I'm staying with that to avoid new bugs.
+    // Only tiles next to some scent can change, everything else stays at zero
+    const int min_x = std::max( { 1, center.x() - SCENT_RADIUS, scented_area.p_min.x() - 1 } );
+    const int min_y = std::max( { 1, center.y() - SCENT_RADIUS, scented_area.p_min.y() - 1 } );
+    const int max_x = std::min( { MAPSIZE_X - 1, center.x() + SCENT_RADIUS + 1,
+                                  scented_area.p_max.x() + 1
+                                } );
+    const int max_y = std::min( { MAPSIZE_Y - 1, center.y() + SCENT_RADIUS + 1,
+                                  scented_area.p_max.y() + 1
+                                } );
+    if( scented_area.p_min.x() >= scented_area.p_max.x() || min_x >= max_x || min_y >= max_y ) {
+        return;
+    }
 
-    // These two matrices are transposed so that x addresses are contiguous in memory
-    scent_array<int> sum_3_scent_y;
-    scent_array<int> squares_used_y;
+    // The tiles in [min_x, max_x) x [min_y, max_y) get updated, which needs the flags and
+    // scent of one more tile on every side.
+    // All the loops below run along y, which is contiguous in memory and branch free, so
+    // that the compiler can vectorize them.
 
     // these are for caching flag lookups
     scent_array<bool> blocks_scent; // currently only ter_furn_flag::TFLAG_NO_SCENT blocks scent
     scent_array<bool> reduces_scent;
-
-    // for loop constants
-    const int scentmap_minx = center.x() - SCENT_RADIUS;
-    const int scentmap_maxx = center.x() + SCENT_RADIUS;
-    const int scentmap_miny = center.y() - SCENT_RADIUS;
-    const int scentmap_maxy = center.y() + SCENT_RADIUS;
+    m.scent_blockers( blocks_scent, reduces_scent, point_bub_ms( min_x - 1, min_y - 1 ),
+                      point_bub_ms( max_x, max_y ) );
+
+    // How much of a tile's scent takes part in diffusion: none through NO_SCENT, 20% on
+    // REDUCE_SCENT squares
+    scent_array<int> weight;
+    for( int x = min_x - 1; x <= max_x; ++x ) {
+        for( int y = min_y - 1; y <= max_y; ++y ) {
+            weight[x][y] = blocks_scent[x][y] ? 0 : reduces_scent[x][y] ? 2 : 10;
+        }
+    }
 
     // decrease this to reduce gas spread. Keep it under 125 for
     // stability. This is essentially a decimal number * 1000.
     const int diffusivity = 100;
 
-    // The new scent flag searching function. Should be wayyy faster than the old one.
-    m.scent_blockers( blocks_scent, reduces_scent, point_bub_ms( scentmap_minx - 1, scentmap_miny - 1 ),
-                      point_bub_ms( scentmap_maxx + 1, scentmap_maxy + 1 ) );
     // Sum neighbors in the y direction.  This way, each square gets called 3 times instead of 9
-    // times. This cost us an extra loop here, but it also eliminated a loop at the end, so there
-    // is a net performance improvement over the old code. Could probably still be better.
-    // note: this method needs an array that is one square larger on each side in the x direction
-    // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
-    // MAPSIZE_X, but if that changes, this may need tweaking.
-    for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
-        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
+    // times.
+    scent_array<int> sum_3_scent_y;
+    scent_array<int> squares_used_y;
+    for( int x = min_x - 1; x <= max_x; ++x ) {
+        const std::array<int, MAPSIZE_Y> &w = weight[x];
+        const std::array<int, MAPSIZE_Y> &sc = grscent[x];
+        for( int y = min_y; y < max_y; ++y ) {
             // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = y - 1; i <= y + 1; ++i ) {
-                if( !blocks_scent[x][i] ) {
-                    if( reduces_scent[x][i] ) {
-                        // only 20% of scent can diffuse on REDUCE_SCENT squares
-                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
-                        squares_used_y[y][x] += 2;
-                    } else {
-                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
-                        squares_used_y[y][x] += 10;
-                    }
-                }
-            }
+            sum_3_scent_y[x][y] = w[y - 1] * sc[y - 1] + w[y] * sc[y] + w[y + 1] * sc[y + 1];
+            squares_used_y[x][y] = w[y - 1] + w[y] + w[y + 1];
         }
     }
 
-    // Rest of the scent map
-    for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
-        for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            int &scent_here = grscent[x][y];
-            if( !blocks_scent[x][y] ) {
-                // to how many neighboring squares do we diffuse out? (include our own square
-                // since we also include our own square when diffusing in)
-                const int squares_used = squares_used_y[y][x - 1]
-                                         + squares_used_y[y][x]
-                                         + squares_used_y[y][x + 1];
-
-                int this_diffusivity;
-                if( !reduces_scent[x][y] ) {
-                    this_diffusivity = diffusivity;
-                } else {
-                    this_diffusivity = diffusivity / 5; //less air movement for REDUCE_SCENT square
-                }
-                // take the old scent and subtract what diffuses out
-                int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
-                // neighboring REDUCE_SCENT squares absorb some scent
-                temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
-                // we've already summed neighboring scent values in the y direction in the previous
-                // loop. Now we do it for the x direction, multiply by diffusion, and this is what
-                // diffuses into our current square.
-                scent_here =
-                    ( temp_scent
-                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
-                                             + sum_3_scent_y[y][x]
-                                             + sum_3_scent_y[y][x + 1] )
-                    ) / ( 1000 * 10 );
-            } else {
-                // this cell blocks scent via NO_SCENT (in json)
-                scent_here = 0;
-            }
+    for( int x = min_x; x < max_x; ++x ) {
+        for( int y = min_y; y < max_y; ++y ) {
+            // to how many neighboring squares do we diffuse out? (include our own square
+            // since we also include our own square when diffusing in)
+            const int squares_used = squares_used_y[x - 1][y]
+                                     + squares_used_y[x][y]
+                                     + squares_used_y[x + 1][y];
+            //less air movement for REDUCE_SCENT square
+            const int this_diffusivity = reduces_scent[x][y] ? diffusivity / 5 : diffusivity;
+            const int scent_here = grscent[x][y];
+            // take the old scent and subtract what diffuses out
+            int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
+            // neighboring REDUCE_SCENT squares absorb some scent
+            temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
+            // we've already summed neighboring scent values in the y direction in the previous
+            // loop. Now we do it for the x direction, multiply by diffusion, and this is what
+            // diffuses into our current square.
+            const int diffused =
+                ( temp_scent
+                  + this_diffusivity * ( sum_3_scent_y[x - 1][y]
+                                         + sum_3_scent_y[x][y]
+                                         + sum_3_scent_y[x + 1][y] )
+                ) / ( 1000 * 10 );
+            // a cell that blocks scent via NO_SCENT (in json) has none
+            grscent[x][y] = blocks_scent[x][y] ? 0 : diffused;
         }
     }
+
+    add_to_scented_area( point_bub_ms( min_x, min_y ) );
+    add_to_scented_area( point_bub_ms( max_x - 1, max_y - 1 ) );
 }
 
 namespace
@@ -12,6 +12,7 @@
 
 #include "calendar.h"
 #include "coordinates.h"
+#include "cuboid_rectangle.h"
 #include "enums.h" // IWYU pragma: keep
 #include "map_scale_constants.h"
 #include "type_id.h"
@@ -50,12 +51,18 @@ class scent_map
         using scent_array = std::array<std::array<T, MAPSIZE_Y>, MAPSIZE_X>;
 
         scent_array<int> grscent;
+        // Scent is zero everywhere outside of this area, so update and decay don't
+        // have to look at the rest of the map.
+        half_open_rectangle<point_bub_ms> scented_area; // NOLINT(cata-serialize)
         scenttype_id typescent;
         std::optional<tripoint_bub_ms> player_last_position; // NOLINT(cata-serialize)
         time_point player_last_moved = calendar::before_time_starts; // NOLINT(cata-serialize)
 
         const game &gm; // NOLINT(cata-serialize)
 
+        void add_to_scented_area( const point_bub_ms &p );
+        void recalculate_scented_area();
+
     public:
         explicit scent_map( const game &g ) : gm( g ) { }
 
@@ -3561,6 +3561,15 @@ static void CheckMessages()
         needupdate = resized = handle_resize( resize_dims.value().x, resize_dims.value().y );
     }
     // resizing already reinitializes the render target
+    if( render_target_reset ) {
+        // The cached map frames were lost with the render targets
+        if( closetilecontext ) {
+            closetilecontext->invalidate_map_frame_cache();
+        }
+        if( fartilecontext ) {
+            fartilecontext->invalidate_map_frame_cache();
+        }
+    }
     if( !resized && render_target_reset ) {
         throwErrorIf( !SetupRenderTarget(), "SetupRenderTarget failed" );
         needupdate = true;
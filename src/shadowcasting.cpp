@@ -3,13 +3,17 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iterator>
+#include <memory>
+#include <vector>
 
+#include "cached_options.h"
 #include "coordinates.h"
 #include "cuboid_rectangle.h"
 #include "fragment_cloud.h" // IWYU pragma: keep
 #include "line.h"
 #include "list.h"
 #include "point.h"
+#include "thread_pool.h"
 
 // historically 8 bits is enough for rise and run, as a shadowcasting radius of 60
 // readily fits within that space. larger shadowcasting volumes may require larger
@@ -537,66 +541,71 @@ void cast_zlight(
     const tripoint_bub_ms &origin, const int offset_distance, const T numerator,
     vertical_direction dir )
 {
+    using segment_fn = void ( * )( const array_of_grids_of<T> &, const array_of_grids_of<const T> &,
+                                   const array_of_grids_of<const bool> &, const tripoint_bub_ms &, int, T );
+    std::vector<segment_fn> segments;
+    segments.reserve( 24 );
+
     if( dir == vertical_direction::DOWN || dir == vertical_direction::BOTH ) {
         // Down lateral
         // @..
         //  ..
         //   .
-        cast_horizontal_zlight_segment < 0, 1, 1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, 1, 1, 0, -1, T, calc, is_transparent, accumulate > );
         // @
         // ..
         // ...
-        cast_horizontal_zlight_segment < 1, 0, 0, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 1, 0, 0, 1, -1, T, calc, is_transparent, accumulate > );
         //   .
         //  ..
         // @..
-        cast_horizontal_zlight_segment < 0, -1, 1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, -1, 1, 0, -1, T, calc, is_transparent, accumulate > );
         // ...
         // ..
         // @
-        cast_horizontal_zlight_segment < -1, 0, 0, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < -1, 0, 0, 1, -1, T, calc, is_transparent, accumulate > );
         // ..@
         // ..
         // .
-        cast_horizontal_zlight_segment < 0, 1, -1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, 1, -1, 0, -1, T, calc, is_transparent, accumulate > );
         //   @
         //  ..
         // ...
-        cast_horizontal_zlight_segment < 1, 0, 0, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 1, 0, 0, -1, -1, T, calc, is_transparent, accumulate > );
         // .
         // ..
         // ..@
-        cast_horizontal_zlight_segment < 0, -1, -1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, -1, -1, 0, -1, T, calc, is_transparent, accumulate > );
         // ...
         //  ..
         //   @
-        cast_horizontal_zlight_segment < -1, 0, 0, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < -1, 0, 0, -1, -1, T, calc, is_transparent, accumulate > );
 
         // Straight down
         // @.
         // ..
-        cast_vertical_zlight_segment < 1, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < 1, 1, -1, T, calc, is_transparent, accumulate > );
         // ..
         // @.
-        cast_vertical_zlight_segment < 1, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < 1, -1, -1, T, calc, is_transparent, accumulate > );
         // .@
         // ..
-        cast_vertical_zlight_segment < -1, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < -1, 1, -1, T, calc, is_transparent, accumulate > );
         // ..
         // .@
-        cast_vertical_zlight_segment < -1, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < -1, -1, -1, T, calc, is_transparent, accumulate > );
     }
 
     if( dir == vertical_direction::UP || dir == vertical_direction::BOTH ) {
@@ -604,61 +613,116 @@ void cast_zlight(
         // @..
         //  ..
         //   .
-        cast_horizontal_zlight_segment < 0, 1, 1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, 1, 1, 0, 1, T, calc, is_transparent, accumulate > );
         // @
         // ..
         // ...
-        cast_horizontal_zlight_segment < 1, 0, 0, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 1, 0, 0, 1, 1, T, calc, is_transparent, accumulate > );
         // ..@
         // ..
         // .
-        cast_horizontal_zlight_segment < 0, -1, 1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, -1, 1, 0, 1, T, calc, is_transparent, accumulate > );
         //   @
         //  ..
         // ...
-        cast_horizontal_zlight_segment < -1, 0, 0, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < -1, 0, 0, 1, 1, T, calc, is_transparent, accumulate > );
         //   .
         //  ..
         // @..
-        cast_horizontal_zlight_segment < 0, 1, -1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, 1, -1, 0, 1, T, calc, is_transparent, accumulate > );
         // ...
         // ..
         // @
-        cast_horizontal_zlight_segment < 1, 0, 0, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 1, 0, 0, -1, 1, T, calc, is_transparent, accumulate > );
         // .
         // ..
         // ..@
-        cast_horizontal_zlight_segment < 0, -1, -1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < 0, -1, -1, 0, 1, T, calc, is_transparent, accumulate > );
         // ...
         //  ..
         //   @
-        cast_horizontal_zlight_segment < -1, 0, 0, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_horizontal_zlight_segment < -1, 0, 0, -1, 1, T, calc, is_transparent, accumulate > );
 
         // Straight up
         // @.
         // ..
-        cast_vertical_zlight_segment < 1, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < 1, 1, 1, T, calc, is_transparent, accumulate > );
         // ..
         // @.
-        cast_vertical_zlight_segment < 1, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < 1, -1, 1, T, calc, is_transparent, accumulate > );
         // .@
         // ..
-        cast_vertical_zlight_segment < -1, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < -1, 1, 1, T, calc, is_transparent, accumulate > );
         // ..
         // .@
-        cast_vertical_zlight_segment < -1, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.push_back(
+            cast_vertical_zlight_segment < -1, -1, 1, T, calc, is_transparent, accumulate > );
+    }
+
+    thread_pool &pool = get_thread_pool();
+    if( !threaded_shadowcasting || pool.num_workers() == 0 ) {
+        for( segment_fn segment : segments ) {
+            segment( output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        }
+        return;
+    }
+
+    // Segments overlap along their edges, so each task other than the first one
+    // writes into its own copy of the output caches. Since every write is a max()
+    // of the previous and the new value, merging the copies with max() gives the
+    // same result as the serial version.
+    const size_t num_tasks = std::min( pool.num_workers() + 1, segments.size() );
+    static std::vector<std::array<std::unique_ptr<cata::mdarray<T, point_bub_ms>>, OVERMAP_LAYERS>>
+    scratch;
+    if( scratch.size() < num_tasks - 1 ) {
+        scratch.resize( num_tasks - 1 );
+    }
+    std::vector<array_of_grids_of<T>> task_outputs( num_tasks, output_caches );
+    for( size_t task = 1; task < num_tasks; ++task ) {
+        for( size_t z = 0; z < OVERMAP_LAYERS; ++z ) {
+            if( output_caches[z] == nullptr ) {
+                continue;
+            }
+            std::unique_ptr<cata::mdarray<T, point_bub_ms>> &copy = scratch[task - 1][z];
+            if( copy == nullptr ) {
+                copy = std::make_unique<cata::mdarray<T, point_bub_ms>>();
+            }
+            *copy = *output_caches[z];
+            task_outputs[task][z] = copy.get();
+        }
+    }
+
+    pool.run_parallel( num_tasks, [&]( size_t task ) {
+        for( size_t i = task; i < segments.size(); i += num_tasks ) {
+            segments[i]( task_outputs[task], input_arrays, floor_caches, origin, offset_distance,
+                         numerator );
+        }
+    } );
+
+    for( size_t z = 0; z < OVERMAP_LAYERS; ++z ) {
+        if( output_caches[z] == nullptr ) {
+            continue;
+        }
+        cata::mdarray<T, point_bub_ms> &output = *output_caches[z];
+        for( size_t task = 1; task < num_tasks; ++task ) {
+            const cata::mdarray<T, point_bub_ms> &partial = *task_outputs[task][z];
+            for( size_t x = 0; x < partial.size_x; ++x ) {
+                for( size_t y = 0; y < partial.size_y; ++y ) {
+                    output[x][y] = std::max( output[x][y], partial[x][y] );
+                }
+            }
+        }
     }
 }
 
@@ -431,6 +431,152 @@ static std::vector<centroid> cluster_sounds(
     return sound_clusters;
 }
 
+namespace
+{
+// How far a sound travels through the reality bubble to get to the tiles around it.
+// Walls and floors count as extra distance, so unlike sound_distance the sound has
+// to find its way around buildings.
+class sound_field
+{
+    public:
+        /**
+         * Spreads a sound of @p volume out from @p source until it has reached every one
+         * of @p listeners, or has got too quiet for anything to hear it.
+         */
+        void propagate( const tripoint_bub_ms &source, int volume,
+                        const std::vector<tripoint_bub_ms> &listeners );
+        /** How far the last propagated sound travelled to reach @p p, if it got there. */
+        std::optional<int> distance_to( const tripoint_bub_ms &p ) const;
+
+    private:
+        struct tile {
+            // Only valid if equal to the current stamp, saves clearing the field for every sound
+            uint32_t stamp = 0;
+            uint32_t listener_stamp = 0;
+            int distance = 0;
+        };
+
+        static size_t index( const tripoint_bub_ms &p ) {
+            const size_t level = p.z() + OVERMAP_DEPTH;
+            return ( level * MAPSIZE_Y + p.y() ) * MAPSIZE_X + p.x();
+        }
+        static bool blocks_sound( const map &here, const tripoint_bub_ms &p );
+        static int vertical_cost( int from_z, int to_z );
+
+        uint32_t stamp = 0;
+        std::vector<tile> tiles;
+        // Tiles still to visit, by distance travelled. Kept from one sound to the next
+        // so the storage doesn't have to be allocated again.
+        std::vector<std::vector<tripoint_bub_ms>> buckets;
+};
+
+// Going through a wall or a closed door is as good as this many tiles of open air
+constexpr int wall_attenuation = 10;
+
+bool sound_field::blocks_sound( const map &here, const tripoint_bub_ms &p )
+{
+    const ter_t &ter = here.ter( p ).obj();
+    return ter.movecost == 0 && !ter.has_flag( ter_furn_flag::TFLAG_TRANSPARENT );
+}
+
+int sound_field::vertical_cost( int from_z, int to_z )
+{
+    // Roughly the attenuation of sound_distance, one level at a time
+    const int lower_z = std::min( from_z, to_z );
+    return lower_z >= 0 ? 5 : lower_z == -1 ? 25 : 105;
+}
+
+void sound_field::propagate( const tripoint_bub_ms &source, int volume,
+                             const std::vector<tripoint_bub_ms> &listeners )
+{
+    map &here = get_map();
+    ++stamp;
+    if( tiles.empty() ) {
+        tiles.resize( static_cast<size_t>( MAPSIZE_X ) * MAPSIZE_Y * OVERMAP_LAYERS );
+    }
+    // Monsters with good hearing still hear a sound that travelled almost twice its volume
+    const int max_distance = 2 * volume - 1;
+    if( max_distance < 0 || !here.inbounds( source ) ) {
+        return;
+    }
+    int unreached = 0;
+    for( const tripoint_bub_ms &p : listeners ) {
+        if( !here.inbounds( p ) ) {
+            continue;
+        }
+        tile &t = tiles[index( p )];
+        if( t.listener_stamp != stamp ) {
+            t.listener_stamp = stamp;
+            ++unreached;
+        }
+    }
+
+    // Distances only ever go up, which allows for a bucket queue indexed by them
+    if( buckets.size() <= static_cast<size_t>( max_distance ) ) {
+        buckets.resize( max_distance + 1 );
+    }
+    buckets[0].push_back( source );
+    const int min_z = here.supports_zlevels() ? -OVERMAP_DEPTH : here.get_abs_sub().z();
+    const int max_z = here.supports_zlevels() ? OVERMAP_HEIGHT : here.get_abs_sub().z();
+    for( int distance = 0; distance <= max_distance && unreached > 0; ++distance ) {
+        std::vector<tripoint_bub_ms> &bucket = buckets[distance];
+        // Entries get added to later buckets only, so this one is not touched while going over it
+        for( size_t e = 0; e < bucket.size() && unreached > 0; ++e ) {
+            const tripoint_bub_ms current = bucket[e];
+            tile &t = tiles[index( current )];
+            if( t.stamp == stamp ) {
+                continue;
+            }
+            t.stamp = stamp;
+            t.distance = distance;
+            if( t.listener_stamp == stamp ) {
+                --unreached;
+            }
+
+            const auto visit = [&]( const tripoint_bub_ms & next, int cost ) {
+                const int next_distance = distance + cost;
+                if( next_distance > max_distance || next.z() < min_z || next.z() > max_z ||
+                    !here.inbounds( next ) || tiles[index( next )].stamp == stamp ) {
+                    return;
+                }
+                buckets[next_distance].push_back( next );
+            };
+            // Charged on the way out of a wall rather than on the way in, so the
+            // terrain is looked up once per tile instead of once per neighbour.
+            const int horizontal_cost = blocks_sound( here, current ) ? wall_attenuation : 1;
+            for( const tripoint &offset : eight_horizontal_neighbors ) {
+                visit( current + offset, horizontal_cost );
+            }
+            const int z = current.z();
+            visit( current + tripoint::above, vertical_cost( z, z + 1 ) );
+            visit( current + tripoint::below, vertical_cost( z, z - 1 ) );
+        }
+    }
+    // Whatever is left after all the listeners were reached
+    for( int distance = 0; distance <= max_distance; ++distance ) {
+        buckets[distance].clear();
+    }
+}
+
+std::optional<int> sound_field::distance_to( const tripoint_bub_ms &p ) const
+{
+    if( tiles.empty() || !get_map().inbounds( p ) ) {
+        return std::nullopt;
+    }
+    const tile &t = tiles[index( p )];
+    if( t.stamp != stamp ) {
+        return std::nullopt;
+    }
+    return t.distance;
+}
+
+sound_field &get_sound_field()
+{
+    static sound_field field;
+    return field;
+}
+} // namespace
+
 static int get_signal_for_hordes( const centroid &centr )
 {
     //Volume in  tiles. Signal for hordes in submaps
@@ -460,6 +606,9 @@ static int get_signal_for_hordes( const centroid &centr )
 void sounds::process_sounds()
 {
     map &here = get_map();
+    sound_field &field = get_sound_field();
+    std::vector<monster *> hearing;
+    std::vector<tripoint_bub_ms> listeners;
 
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = get_weather().weather_id->sound_attn;
@@ -479,25 +628,41 @@ void sounds::process_sounds()
             const tripoint_abs_sm target( abs_sm, source.z() );
             overmap_buffer.signal_hordes( target, sig_power );
         }
+        // The sound never travels less than the distance along any axis, so monsters
+        // and traps outside this range certainly won't hear it.
+        const int range = std::max( vol * 2 - 1, 0 );
+        hearing.clear();
+        listeners.clear();
+        get_creature_tracker().for_each_monster_in_range( here.get_abs( source ), range,
+        [&]( monster & critter ) {
+            if( critter.can_hear() ) {
+                hearing.push_back( &critter );
+                listeners.push_back( critter.pos_bub() );
+            }
+        } );
+        for( const trap *trapType : trap::get_sound_triggered_traps() ) {
+            for( const tripoint_bub_ms &tp : here.trap_locations( trapType->id ) ) {
+                if( square_dist( source, tp ) <= range ) {
+                    listeners.push_back( tp );
+                }
+            }
+        }
+        field.propagate( source, vol, listeners );
+
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        for( monster *critter : hearing ) {
             // TODO: Generalize this to Creature::hear_sound
-            const int dist = sound_distance( source, critter.pos_bub() );
-            if( vol * 2 > dist ) {
-                // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist, this_centroid.provocative );
+            if( const std::optional<int> dist = field.distance_to( critter->pos_bub() ) ) {
+                critter->hear_sound( source, vol, *dist, this_centroid.provocative );
             }
         }
         // Trigger sound-triggered traps and ensure they are still valid
         for( const trap *trapType : trap::get_sound_triggered_traps() ) {
             for( const tripoint_bub_ms &tp : here.trap_locations( trapType->id ) ) {
-                const int dist = sound_distance( source, tp );
+                const std::optional<int> dist = field.distance_to( tp );
                 const trap &tr = here.tr_at( tp );
-                // Exclude traps that certainly won't hear the sound
-                if( vol * 2 > dist ) {
-                    if( tr.triggered_by_sound( vol, dist ) ) {
-                        tr.trigger( tp );
-                    }
+                if( dist && tr.triggered_by_sound( vol, *dist ) ) {
+                    tr.trigger( tp );
                 }
             }
         }
@@ -404,7 +404,7 @@ void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
                 this->m->itm[x][y].emplace( itm );
             }
 
-            for( std::map<field_type_id, field_entry>::iterator it = copy_from->m->fld[x][y].begin();
+            for( field::iterator it = copy_from->m->fld[x][y].begin();
                  it != copy_from->m->fld[x][y].end(); it++ ) {
                 if( !this->m->fld[x][y].find_field( it->first, false ) ) {
                     this->m->fld[x][y].add_field( it->first, it->second.get_field_intensity(),
@@ -416,7 +416,7 @@ void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
                 }
             }
 
-            for( std::map<field_type_id, field_entry>::iterator it = this->m->fld[x][y].begin();
+            for( field::iterator it = this->m->fld[x][y].begin();
                  it != this->m->fld[x][y].end(); it++ ) {
                 this->field_count++;
             }
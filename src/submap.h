@@ -310,6 +310,9 @@ class submap
         int field_count = 0;
         time_point last_touched = calendar::turn_zero;
         bool reverted = false; // NOLINT(cata-serialize)
+        // Whether this may differ from the copy on disk. Cleared when the submap is
+        // read from or written to disk, set again once mapbuffer hands it out.
+        bool unsaved_changes = true; // NOLINT(cata-serialize)
         std::vector<spawn_point> spawns;
         /**
          * Vehicles on this submap (their (0,0) point is on this submap).
@@ -0,0 +1,147 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <utility>
+
+thread_pool::thread_pool( size_t num_workers )
+{
+    workers.reserve( num_workers );
+    for( size_t i = 0; i < num_workers; ++i ) {
+        workers.emplace_back( [this]() {
+            worker_loop();
+        } );
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock( jobs_mutex );
+        stopping = true;
+    }
+    jobs_cv.notify_all();
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+}
+
+void thread_pool::worker_loop()
+{
+    while( true ) {
+        std::packaged_task<void()> job;
+        {
+            std::unique_lock<std::mutex> lock( jobs_mutex );
+            jobs_cv.wait( lock, [this]() {
+                return stopping || !jobs.empty();
+            } );
+            // Finish whatever was queued before stopping, somebody may be waiting on it
+            if( jobs.empty() ) {
+                return;
+            }
+            job = std::move( jobs.front() );
+            jobs.pop_front();
+        }
+        job();
+    }
+}
+
+std::future<void> thread_pool::submit( std::function<void()> job )
+{
+    std::packaged_task<void()> task( std::move( job ) );
+    std::future<void> result = task.get_future();
+    if( workers.empty() ) {
+        task();
+        return result;
+    }
+    {
+        std::lock_guard<std::mutex> lock( jobs_mutex );
+        jobs.emplace_back( std::move( task ) );
+    }
+    jobs_cv.notify_one();
+    return result;
+}
+
+namespace
+{
+// Shared between run_parallel and its helper jobs. Helpers may only start after
+// run_parallel has returned (when the workers were busy with something else), so
+// this is kept alive by them rather than by the caller's stack.
+struct parallel_run_state {
+    const std::function<void( size_t )> *task = nullptr;
+    size_t count = 0;
+    std::atomic<size_t> next{ 0 };
+    size_t finished = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    // Runs tasks until none are left to claim
+    void work() {
+        while( true ) {
+            const size_t i = next++;
+            if( i >= count ) {
+                return;
+            }
+            std::exception_ptr thrown;
+            try {
+                ( *task )( i );
+            } catch( ... ) {
+                thrown = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock( mutex );
+            if( thrown && !error ) {
+                error = thrown;
+            }
+            if( ++finished == count ) {
+                cv.notify_all();
+            }
+        }
+    }
+};
+} // namespace
+
+void thread_pool::run_parallel( size_t count, const std::function<void( size_t )> &task )
+{
+    if( count == 0 ) {
+        return;
+    }
+    if( workers.empty() || count == 1 ) {
+        for( size_t i = 0; i < count; ++i ) {
+            task( i );
+        }
+        return;
+    }
+
+    std::shared_ptr<parallel_run_state> state = std::make_shared<parallel_run_state>();
+    state->task = &task;
+    state->count = count;
+    const size_t helpers = std::min( workers.size(), count - 1 );
+    {
+        std::lock_guard<std::mutex> lock( jobs_mutex );
+        for( size_t i = 0; i < helpers; ++i ) {
+            jobs.emplace_back( [state]() {
+                state->work();
+            } );
+        }
+    }
+    jobs_cv.notify_all();
+
+    state->work();
+
+    std::unique_lock<std::mutex> lock( state->mutex );
+    state->cv.wait( lock, [&state]() {
+        return state->finished == state->count;
+    } );
+    if( state->error ) {
+        std::rethrow_exception( state->error );
+    }
+}
+
+thread_pool &get_thread_pool()
+{
+    static thread_pool pool( std::max( std::thread::hardware_concurrency(), 1U ) - 1 );
+    return pool;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef CATA_SRC_THREAD_POOL_H
+#define CATA_SRC_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+/**
+ * A fixed set of worker threads that run queued jobs.
+ *
+ * Jobs must not touch game state that the main thread might be using at the
+ * same time; it's up to the caller to hand them data that is either private
+ * to the job or not modified while the job runs.
+ */
+class thread_pool
+{
+    public:
+        explicit thread_pool( size_t num_workers );
+        ~thread_pool();
+
+        thread_pool( const thread_pool & ) = delete;
+        thread_pool &operator=( const thread_pool & ) = delete;
+
+        size_t num_workers() const {
+            return workers.size();
+        }
+
+        /**
+         * Queues a job to be run on one of the workers.
+         * With no workers the job is run right away on the calling thread.
+         */
+        std::future<void> submit( std::function<void()> job );
+
+        /**
+         * Calls task( i ) for every i in [0, count), spread over the workers and the
+         * calling thread. Returns once all calls have finished. If any of them threw,
+         * the first exception is rethrown here.
+         */
+        void run_parallel( size_t count, const std::function<void( size_t )> &task );
+
+    private:
+        void worker_loop();
+
+        std::vector<std::thread> workers;
+        std::deque<std::packaged_task<void()>> jobs;
+        std::mutex jobs_mutex;
+        std::condition_variable jobs_cv;
+        bool stopping = false;
+};
+
+/**
+ * The pool shared by the whole game, sized from the number of hardware threads
+ * (leaving one for the main thread). Created on first use.
+ */
+thread_pool &get_thread_pool();
+
+#endif // CATA_SRC_THREAD_POOL_H
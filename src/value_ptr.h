@@ -3,6 +3,8 @@
 #define CATA_SRC_VALUE_PTR_H
 
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 class JsonOut;
 class JsonValue;
@@ -66,22 +68,34 @@ bool value_ptr_equals( const value_ptr<T> &lhs, const value_ptr<T> &rhs )
  * it hides the fact it is a unique_ptr. It is intended for helping make types
  * noexcept movable by moving non-noexcept-movable types to the heap.
  *
- * Contractually speaking, should never be empty. However for performance reasons
- * in eg. item, moved-from heap<> objects do not automatically reset with a new
- * copy of the wrapped data.
+ * A default constructed T is not allocated at all. Until something writes to it,
+ * reads see one shared default instance, so the many item members that stay empty
+ * for the item's whole life cost nothing but the pointer, also when the item is
+ * copied. Moved-from heap<> objects fall back to that same default.
+ * Anything that could write counts as writing: the non-const overloads of
+ * begin(), end(), find(), operator[], operator* and the conversion to T& all
+ * allocate. Code that only reads should go through a const heap<>.
  */
 template <class T>
 struct heap {
     private:
         std::unique_ptr<T> heaped_;
 
+        static const T &default_value() {
+            static const T value{};
+            return value;
+        }
+
     public:
-        template<typename ...Args>
+        heap() = default;
+
+        template<typename Arg, typename ...Args, typename = std::enable_if_t<
+                     !std::is_same_v<std::decay_t<Arg>, heap>>>
         // NOLINTNEXTLINE(google-explicit-constructor)
-        heap( Args &&...args ) : heaped_{ new T{ std::forward<Args>( args )... } } {}
+        heap( Arg &&arg, Args &&...args ) :
+            heaped_{ new T{ std::forward<Arg>( arg ), std::forward<Args>( args )... } } {}
 
         // Unlike value_ptr, moves actually move and leave the moved-from heap empty.
-        // Using it again will cause a segfault without resetting it first.
         heap( heap && ) noexcept = default;
         heap &operator=( heap &&other ) noexcept = default;
 
@@ -90,11 +104,10 @@ struct heap {
             *this = rhs;
         }
         heap &operator=( heap const &rhs ) {
-            // This should always be true, however, sanity says do the right thing.
             if( rhs.heaped_ ) {
                 heaped_.reset( new T{ *rhs.heaped_ } );
             } else {
-                heaped_.reset( new T{} );
+                heaped_.reset();
             }
             return *this;
         }
@@ -112,16 +125,16 @@ struct heap {
         // Implicit conversion functions
         // NOLINTNEXTLINE(google-explicit-constructor)
         operator T &() & { // *NOPAD*
-            return *heaped_;
+            return val();
         }
         // NOLINTNEXTLINE(google-explicit-constructor)
         operator T const &() const & { // *NOPAD*
-            return *heaped_;
+            return val();
         }
         // Intentionally move construct a value T to avoid binding a ref to a temporary.
         // NOLINTNEXTLINE(google-explicit-constructor)
         operator T() && { // *NOPAD*
-            return std::move( *heaped_ );
+            return heaped_ ? std::move( *heaped_ ) : T{};
         }
 
         // The one weird one: since this is ultimately backed on the heap,
@@ -130,23 +143,26 @@ struct heap {
         // to peel back the heap<> wrapper because otherwise template type deduction
         // might break.
         T &operator*() & { // *NOPAD*
-            return *heaped_;
+            return val();
         }
         T const &operator*() const & { // *NOPAD*
-            return *heaped_;
+            return val();
         }
         // Intentionally move construct a value T to avoid binding a ref to a temporary.
         T operator*() && { // *NOPAD*
-            return std::move( *heaped_ );
+            return heaped_ ? std::move( *heaped_ ) : T{};
         }
 
     private:
-        // Helper for proxy functions.
+        // Helper for proxy functions. Only writable access allocates.
         T &val() {
+            if( !heaped_ ) {
+                heaped_.reset( new T{} );
+            }
             return *heaped_;
         }
         T const &val() const {
-            return *heaped_;
+            return heaped_ ? *heaped_ : default_value();
         }
     public:
 
@@ -166,17 +182,11 @@ struct heap {
 
         // Comparison operators.
         auto operator==( heap const &rhs ) const -> decltype( val() == val() ) {
-            const T *lhsp = heaped_.get();
-            const T *rhsp = rhs.heaped_.get();
-
-            return rhsp && lhsp && *rhsp == *lhsp;
+            return val() == rhs.val();
         }
 
         auto operator!=( heap const &rhs ) const -> decltype( val() != val() ) {
-            const T *lhsp = heaped_.get();
-            const T *rhsp = rhs.heaped_.get();
-
-            return rhsp && lhsp && *rhsp != *lhsp;
+            return val() != rhs.val();
         }
 
 
@@ -184,7 +194,11 @@ struct heap {
         PROXY_CONST( empty )
         PROXY_CONST( count )
         PROXY_CONST( size )
-        PROXY( clear )
+
+        // Frees the storage instead of keeping an empty container around
+        void clear() {
+            heaped_.reset();
+        }
 
         // Iterators
         PROXY( begin )
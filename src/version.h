@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "5511eb9b-dirty"
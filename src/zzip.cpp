@@ -7,6 +7,7 @@
 #include <functional>
 #include <iosfwd>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <system_error>
@@ -29,6 +30,7 @@
 #include "flexbuffer_json.h"
 #include "mmap_file.h"
 #include "std_hash_fs_path.h"
+#include "thread_pool.h"
 
 namespace
 {
@@ -136,6 +138,50 @@ struct cached_zstd_context {
 
 std::unordered_map<std::string, cached_zstd_context> cached_contexts;
 
+// Compression contexts for zzip::add_files, which compresses on several threads at
+// once and can't share the cached ones. Indexed by dictionary path like above.
+class spare_compression_contexts
+{
+    public:
+        ~spare_compression_contexts() {
+            for( std::pair<const std::string, std::vector<ZSTD_CCtx *>> &idle : idle_ ) {
+                for( ZSTD_CCtx *cctx : idle.second ) {
+                    ZSTD_freeCCtx( cctx );
+                }
+            }
+        }
+
+        // Set up like the cached context for the same dictionary
+        ZSTD_CCtx *take( const std::string &dictionary_path, std::string_view dictionary ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex_ );
+                std::vector<ZSTD_CCtx *> &idle = idle_[dictionary_path];
+                if( !idle.empty() ) {
+                    ZSTD_CCtx *cctx = idle.back();
+                    idle.pop_back();
+                    return cctx;
+                }
+            }
+            ZSTD_CCtx *cctx = ZSTD_createCCtx();
+            if( !dictionary_path.empty() ) {
+                ZSTD_CCtx_setParameter( cctx, ZSTD_c_compressionLevel, 7 );
+                ZSTD_CCtx_loadDictionary_byReference( cctx, dictionary.data(), dictionary.size() );
+            }
+            return cctx;
+        }
+
+        void give_back( const std::string &dictionary_path, ZSTD_CCtx *cctx ) {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            idle_[dictionary_path].push_back( cctx );
+        }
+
+    private:
+        std::mutex mutex_;
+        std::unordered_map<std::string, std::vector<ZSTD_CCtx *>> idle_;
+};
+
+spare_compression_contexts spare_contexts;
+
 } // namespace
 
 struct zzip::compressed_entry {
@@ -331,11 +377,16 @@ std::pair<void *, size_t> read_and_skip_entry_metadata(
 } // namespace
 
 struct zzip::context {
-    context( ZSTD_CCtx *cctx, ZSTD_DCtx *dctx )
-        : cctx{ cctx }, dctx{ dctx }
+    context( ZSTD_CCtx *cctx, ZSTD_DCtx *dctx, std::string dictionary_path,
+             std::string_view dictionary )
+        : cctx{ cctx }, dctx{ dctx }, dictionary_path{ std::move( dictionary_path ) },
+          dictionary{ dictionary }
     {}
     ZSTD_CCtx *cctx;
     ZSTD_DCtx *dctx;
+    // Lets spare_contexts hand out contexts matching cctx
+    std::string dictionary_path;
+    std::string_view dictionary;
 };
 
 zzip::zzip( std::filesystem::path path, std::shared_ptr<mmap_file> file, JsonObject footer )
@@ -387,6 +438,7 @@ std::shared_ptr<zzip> zzip::load( std::filesystem::path const &path,
 
     ZSTD_CCtx *cctx;
     ZSTD_DCtx *dctx;
+    std::string_view dictionary_view;
     if( dictionary_path.empty() ) {
         cctx = ZSTD_createCCtx();
         dctx = ZSTD_createDCtx();
@@ -394,6 +446,7 @@ std::shared_ptr<zzip> zzip::load( std::filesystem::path const &path,
                it != cached_contexts.end() ) {
         cctx = it->second.cctx;
         dctx = it->second.dctx;
+        dictionary_view = { it->second.dictionary_.data(), it->second.dictionary_.size() };
     } else {
         cctx = ZSTD_createCCtx();
         ZSTD_CCtx_setParameter( cctx, ZSTD_c_compressionLevel, 7 );
@@ -408,10 +461,13 @@ std::shared_ptr<zzip> zzip::load( std::filesystem::path const &path,
             ZSTD_DCtx_loadDictionary_byReference( dctx, dictionary.data(), dictionary.size() );
         }
 
-        cached_contexts.emplace( dictionary_path.string(), cached_zstd_context{ std::move( dictionary ), cctx, dctx } );
+        cached_zstd_context cached{ std::move( dictionary ), cctx, dctx };
+        it = cached_contexts.emplace( dictionary_path.string(), std::move( cached ) ).first;
+        dictionary_view = { it->second.dictionary_.data(), it->second.dictionary_.size() };
     }
 
-    zip->ctx_ = std::make_unique<zzip::context>( cctx, dctx );
+    zip->ctx_ = std::make_unique<zzip::context>( cctx, dctx, dictionary_path.string(),
+                dictionary_view );
 
     if( needs_footer && !zip->rewrite_footer() ) {
         return nullptr;
@@ -465,6 +521,72 @@ bool zzip::add_file( std::filesystem::path const &zzip_relative_path, std::strin
     return true;
 }
 
+bool zzip::add_files( std::vector<std::pair<std::filesystem::path, std::string>> const &files )
+{
+    if( files.empty() ) {
+        return true;
+    }
+
+    // Compress everything on the side first, the archive itself is only touched
+    // from this thread.
+    std::vector<std::vector<char>> compressed( files.size() );
+    std::vector<size_t> compressed_sizes( files.size() );
+    get_thread_pool().run_parallel( files.size(), [&]( size_t i ) {
+        std::string_view content = files[i].second;
+        ZSTD_CCtx *cctx = spare_contexts.take( ctx_->dictionary_path, ctx_->dictionary );
+        on_out_of_scope give_back( [&] {
+            spare_contexts.give_back( ctx_->dictionary_path, cctx );
+        } );
+        compressed[i].resize( ZSTD_compressBound( content.length() ) );
+        compressed_sizes[i] = ZSTD_compress2( cctx, compressed[i].data(), compressed[i].size(),
+                                              content.data(), content.size() );
+    } );
+
+    JsonObject footer_copy = copy_footer();
+    footer_copy.allow_omitted_members();
+    zzip_footer footer{ footer_copy };
+
+    std::optional<zzip_meta> meta_opt = footer.get_meta();
+    size_t content_end = 0;
+    if( meta_opt.has_value() ) {
+        content_end = meta_opt->content_end;
+    }
+
+    std::vector<compressed_entry> new_entries;
+    new_entries.reserve( files.size() );
+    size_t required_size = content_end + kFixedSizeOverhead;
+    for( size_t i = 0; i < files.size(); ++i ) {
+        if( ZSTD_isError( compressed_sizes[i] ) ) {
+            return false;
+        }
+        new_entries.emplace_back( compressed_entry{ files[i].first.generic_u8string(), 0, 0 } );
+        required_size += ZSTD_SKIPPABLEHEADERSIZE + new_entries.back().path.length() +
+                         kEntryChecksumFrameSize + compressed_sizes[i];
+    }
+    if( !ensure_capacity_for( required_size ) ) {
+        return false;
+    }
+
+    for( size_t i = 0; i < files.size(); ++i ) {
+        compressed_entry &entry = new_entries[i];
+        bool fits = true;
+        entry.offset = content_end;
+        entry.len = write_entry_at( entry.path, content_end, [&]( void *dest, size_t capacity ) {
+            fits = capacity >= compressed_sizes[i];
+            if( fits ) {
+                memcpy( dest, compressed[i].data(), compressed_sizes[i] );
+            }
+            return fits ? compressed_sizes[i] : 0;
+        } );
+        if( !fits || entry.len == 0 || ZSTD_isError( entry.len ) ) {
+            return false;
+        }
+        content_end += entry.len;
+    }
+
+    return update_footer( footer_copy, content_end, new_entries );
+}
+
 
 bool zzip::copy_files( std::vector<std::filesystem::path> const &zzip_relative_paths,
                        std::shared_ptr<zzip> const &from )
@@ -661,8 +783,10 @@ size_t zzip::ensure_capacity_for( size_t bytes )
     return new_size;
 }
 
-// Actually performs the compression and encoding of a file into the zzip.
-size_t zzip::write_file_at( std::string_view filename, std::string_view content, size_t offset )
+// Encodes an entry around the compressed frame that write_frame puts at the given
+// destination, returning its size or a zstd error.
+template<typename WriteFrame>
+size_t zzip::write_entry_at( std::string_view filename, size_t offset, WriteFrame write_frame )
 {
     // The format of a compressed entry is a series of zstd frames.
     // There are an unbounded number of leading skippable frames of unspecified content.
@@ -690,13 +814,7 @@ size_t zzip::write_file_at( std::string_view filename, std::string_view content,
     offset += header_size;
     // Make room for the checksum frame before the file.
     offset += kEntryChecksumFrameSize;
-    size_t file_size = ZSTD_compress2(
-                           ctx_->cctx,
-                           file_base_plus( offset ),
-                           file_capacity_at( offset ),
-                           content.data(),
-                           content.size()
-                       );
+    size_t file_size = write_frame( file_base_plus( offset ), file_capacity_at( offset ) );
     if( ZSTD_isError( file_size ) ) {
         return file_size;
     }
@@ -716,6 +834,14 @@ size_t zzip::write_file_at( std::string_view filename, std::string_view content,
     return header_size + checksum_size + file_size;
 }
 
+// Actually performs the compression and encoding of a file into the zzip.
+size_t zzip::write_file_at( std::string_view filename, std::string_view content, size_t offset )
+{
+    return write_entry_at( filename, offset, [&]( void *dest, size_t capacity ) {
+        return ZSTD_compress2( ctx_->cctx, dest, capacity, content.data(), content.size() );
+    } );
+}
+
 // Writes a new footer at the end of the zzip, copying old entries from the given
 // original JsonObject and inserting the given new entries.
 // If shrink_to_fit is true, will shrink the file as needed to eliminate padding bytes
@@ -7,8 +7,10 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "flexbuffer_json.h"
@@ -70,6 +72,14 @@ class zzip
          */
         bool add_file( std::filesystem::path const &zzip_relative_path, std::string_view content );
 
+        /**
+         * Writes several files at once, as pairs of path and contents. They are compressed
+         * in parallel on the thread pool and appended in the given order, with a single
+         * footer update. The paths must be distinct.
+         * Returns true on success, false on any error.
+         */
+        bool add_files( std::vector<std::pair<std::filesystem::path, std::string>> const &files );
+
         /**
          * Directly copies a compressed entry from one zzip to another. Both zzips
          * must have been opened using the same dictionary. The relative path is
@@ -178,6 +188,8 @@ class zzip
         JsonObject copy_footer() const;
         size_t ensure_capacity_for( size_t bytes );
         size_t write_file_at( std::string_view filename, std::string_view content, size_t offset );
+        template<typename WriteFrame>
+        size_t write_entry_at( std::string_view filename, size_t offset, WriteFrame write_frame );
 
         bool update_footer( JsonObject const &original_footer, size_t content_end,
                             const std::vector<compressed_entry> &entries, bool shrink_to_fit = false );
@@ -1966,6 +1966,7 @@ TEST_CASE( "Warn_when_using_favorited_component", "[crafting]" )
             REQUIRE( !items.empty() );
             REQUIRE( !items.begin()->is_favorite );
             THEN( "no warning" ) {
+                CHECK( !c.crafting_inventory().has_favorite_items() );
                 CHECK( c.can_start_craft( &*recipe_makeshift_funnel, recipe_filter_flags::none ) );
                 CHECK( c.can_start_craft( &*recipe_makeshift_funnel, recipe_filter_flags::no_favorite ) );
             }
@@ -1981,6 +1982,7 @@ TEST_CASE( "Warn_when_using_favorited_component", "[crafting]" )
             REQUIRE( !items.empty() );
             REQUIRE( items.begin()->is_favorite );
             THEN( "warning" ) {
+                CHECK( c.crafting_inventory().has_favorite_items() );
                 CHECK( c.can_start_craft( &*recipe_makeshift_funnel, recipe_filter_flags::none ) );
                 CHECK( !c.can_start_craft( &*recipe_makeshift_funnel, recipe_filter_flags::no_favorite ) );
             }
@@ -1996,6 +1998,7 @@ TEST_CASE( "Warn_when_using_favorited_component", "[crafting]" )
             items.begin()->is_favorite = true;
             REQUIRE( items.begin()->is_favorite );
             THEN( "warning" ) {
+                CHECK( c.crafting_inventory().has_favorite_items() );
                 CHECK( c.can_start_craft( &*recipe_makeshift_funnel, recipe_filter_flags::none ) );
                 CHECK( !c.can_start_craft( &*recipe_makeshift_funnel, recipe_filter_flags::no_favorite ) );
             }
@@ -487,6 +487,80 @@ TEST_CASE( "field_API_test", "[field]" )
     fields_test_cleanup();
 }
 
+TEST_CASE( "field_entries_beyond_inline_storage", "[field]" )
+{
+    field f;
+    CHECK( f.begin() == f.end() );
+    REQUIRE( f.add_field( fd_fire, 1 ) );
+    field_entry *fire = f.find_field( fd_fire );
+    REQUIRE( fire );
+    // Processors keep hold of the current entry while adding others to the tile
+    REQUIRE( f.add_field( fd_smoke, 2 ) );
+    REQUIRE( f.add_field( fd_acid, 3 ) );
+    REQUIRE( f.add_field( fd_blood, 1 ) );
+    CHECK_FALSE( f.add_field( fd_acid, 1 ) );
+    CHECK( f.find_field( fd_fire ) == fire );
+    CHECK( f.field_count() == 4 );
+    CHECK( f.find_field( fd_acid )->get_field_intensity() == 3 );
+
+    std::vector<field_type_id> order;
+    for( const std::pair<field_type_id, field_entry> &fd : f ) {
+        order.push_back( fd.first );
+    }
+    CHECK( order == std::vector<field_type_id> { fd_fire, fd_smoke, fd_acid, fd_blood } );
+
+    field copy = f;
+    CHECK( copy.field_count() == 4 );
+
+    // Removing from the inline part pulls the overflow forward
+    field::iterator it = f.begin();
+    it = f.remove_field( it );
+    CHECK( it->first == fd_smoke );
+    CHECK( f.remove_field( fd_acid ) );
+    CHECK( f.field_count() == 2 );
+    CHECK( f.find_field( fd_blood ) );
+    CHECK_FALSE( f.find_field( fd_fire, false ) );
+
+    CHECK( copy.find_field( fd_fire ) );
+    CHECK( copy.find_field( fd_acid ) );
+    f.clear();
+    CHECK( f.field_count() == 0 );
+    CHECK( f.begin() == f.end() );
+}
+
+TEST_CASE( "field_removal_keeps_earlier_entries_in_place", "[field]" )
+{
+    field f;
+    const std::vector<field_type_id> added = { fd_fire, fd_smoke, fd_acid, fd_blood, fd_bile };
+    for( const field_type_id &fd : added ) {
+        REQUIRE( f.add_field( fd, 1 ) );
+    }
+    field_entry *const fire = f.find_field( fd_fire );
+    field_entry *const acid = f.find_field( fd_acid );
+
+    SECTION( "removing from the overflow" ) {
+        CHECK( f.remove_field( fd_blood ) );
+        CHECK( f.find_field( fd_fire ) == fire );
+        CHECK( f.find_field( fd_acid ) == acid );
+    }
+
+    SECTION( "removing while going over the field" ) {
+        // Removes smoke and blood, the way map::process_fields removes dead fields
+        std::vector<field_type_id> visited;
+        for( field::iterator it = f.begin(); it != f.end(); ) {
+            visited.push_back( it->first );
+            if( it->first == fd_smoke || it->first == fd_blood ) {
+                it = f.remove_field( it );
+            } else {
+                ++it;
+            }
+        }
+        CHECK( visited == added );
+        CHECK( f.field_count() == 3 );
+        CHECK( f.find_field( fd_fire ) == fire );
+    }
+}
+
 TEST_CASE( "player_double_effect_field_test", "[field][player]" )
 {
     fields_test_setup();
@@ -1,5 +1,6 @@
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <limits>
@@ -8,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,6 +28,8 @@
 #include "item_category.h"
 #include "item_factory.h"
 #include "item_location.h"
+#include "json.h"
+#include "json_loader.h"
 #include "itype.h"
 #include "material.h"
 #include "math_defines.h"
@@ -79,6 +83,7 @@ static const itype_id itype_legrig( "legrig" );
 static const itype_id itype_money( "money" );
 static const itype_id itype_neccowafers( "neccowafers" );
 static const itype_id itype_pale_ale( "pale_ale" );
+static const itype_id itype_radio( "radio" );
 static const itype_id itype_rocuronium( "rocuronium" );
 static const itype_id itype_shoulder_strap( "shoulder_strap" );
 static const itype_id itype_single_malt_whiskey( "single_malt_whiskey" );
@@ -382,6 +387,40 @@ TEST_CASE( "item_variables_round-trip_accurately", "[item]" )
     CHECK( i.get_var( "C", tripoint_abs_ms::zero ) == tripoint_abs_ms( 2, 3, 4 ) );
 }
 
+TEST_CASE( "rarely_used_item_members_round-trip", "[item]" )
+{
+    item radio( itype_radio );
+    CHECK( radio.get_frequency() == 0 );
+    CHECK( radio.get_mission_id() == -1 );
+    radio.set_frequency( 42 );
+    radio.set_mission_id( 7 );
+
+    item copy( radio );
+    copy.set_frequency( 0 );
+    CHECK( copy.get_mission_id() == 7 );
+    CHECK( radio.get_frequency() == 42 );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    radio.serialize( jsout );
+    item loaded;
+    loaded.deserialize( json_loader::from_string( os.str() ).get_object() );
+    CHECK( loaded.get_frequency() == 42 );
+    CHECK( loaded.get_mission_id() == 7 );
+    CHECK( loaded.get_dropped_from().is_null() );
+}
+
+TEST_CASE( "item_size_regression", "[item]" )
+{
+    // Worlds hold millions of items, keep rarely used members out of item itself.
+    // The limit is only checked where it was measured, other standard libraries lay
+    // out their containers differently.
+    INFO( "sizeof( item ) is " << sizeof( item ) );
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG) && INTPTR_MAX == INT64_MAX
+    CHECK( sizeof( item ) <= 440 );
+#endif
+}
+
 TEST_CASE( "water_affect_items_while_swimming_check", "[item][water][swimming]" )
 {
     avatar &guy = get_avatar();
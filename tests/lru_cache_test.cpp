@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "cata_catch.h"
+#include "lru_cache.h"
+#include "point.h"
+#include "rng.h"
+
+template<typename Cache>
+static void check_cache_basics()
+{
+    Cache cache;
+    CHECK( cache.get( point( 1, 2 ), -1 ) == -1 );
+    cache.insert( 10, point( 1, 2 ), 1 );
+    cache.insert( 10, point( 2, 1 ), 0 );
+    CHECK( cache.get( point( 1, 2 ), -1 ) == 1 );
+    CHECK( cache.get( point( 2, 1 ), -1 ) == 0 );
+
+    cache.insert( 10, point( 1, 2 ), 0 );
+    CHECK( cache.get( point( 1, 2 ), -1 ) == 0 );
+
+    cache.remove( point( 1, 2 ) );
+    CHECK( cache.get( point( 1, 2 ), -1 ) == -1 );
+    CHECK( cache.get( point( 2, 1 ), -1 ) == 0 );
+
+    cache.clear();
+    CHECK( cache.get( point( 2, 1 ), -1 ) == -1 );
+    cache.insert( 10, point( 2, 1 ), 1 );
+    CHECK( cache.get( point( 2, 1 ), -1 ) == 1 );
+}
+
+TEST_CASE( "lru_cache_basics", "[lru_cache]" )
+{
+    check_cache_basics<lru_cache<point, char>>();
+}
+
+TEST_CASE( "flat_lru_cache_basics", "[lru_cache]" )
+{
+    check_cache_basics<flat_lru_cache<point, char>>();
+}
+
+template<typename Cache>
+static void check_cache_keeps_recently_used()
+{
+    constexpr int limit = 100;
+    Cache cache;
+    for( int i = 0; i < limit; ++i ) {
+        cache.insert( limit, point( i, 0 ), 1 );
+    }
+    // flat_lru_cache only orders entries within a set, so a crowded set may already
+    // have pushed something out. Remember what is there before the next insert.
+    std::vector<bool> present( limit );
+    for( int i = 0; i < limit; ++i ) {
+        present[i] = cache.get( point( i, 0 ), -1 ) == 1;
+    }
+    CHECK( present[limit - 1] );
+    // Read half of the entries, the next insert has to push out one of the others
+    for( int i = 0; i < limit; i += 2 ) {
+        cache.get( point( i, 0 ), -1 );
+    }
+    cache.insert( limit, point( 0, 1 ), 1 );
+    int dropped = 0;
+    for( int i = 0; i < limit; ++i ) {
+        if( !present[i] ) {
+            continue;
+        }
+        const bool kept = cache.get( point( i, 0 ), -1 ) == 1;
+        if( i % 2 == 0 ) {
+            CAPTURE( i );
+            CHECK( kept );
+        }
+        dropped += !kept;
+    }
+    CHECK( cache.get( point( 0, 1 ), -1 ) == 1 );
+    CHECK( dropped <= 1 );
+}
+
+TEST_CASE( "lru_cache_keeps_recently_used", "[lru_cache]" )
+{
+    check_cache_keeps_recently_used<lru_cache<point, char>>();
+}
+
+TEST_CASE( "flat_lru_cache_keeps_recently_used", "[lru_cache]" )
+{
+    check_cache_keeps_recently_used<flat_lru_cache<point, char>>();
+}
+
+TEST_CASE( "flat_lru_cache_survives_churn", "[lru_cache]" )
+{
+    // Random inserts and removes, checked against a plain array of what the cache
+    // may still hold. The keys need several times more room than the limit, so
+    // entries keep getting replaced.
+    constexpr int limit = 50;
+    constexpr int key_range = 200;
+    flat_lru_cache<point, char> cache;
+    std::vector<char> expected( key_range, -1 );
+    for( int i = 0; i < 20000; ++i ) {
+        const int k = rng( 0, key_range - 1 );
+        if( one_in( 4 ) ) {
+            cache.remove( point( k, k ) );
+            expected[k] = -1;
+        } else {
+            const char v = static_cast<char>( rng( 0, 1 ) );
+            cache.insert( limit, point( k, k ), v );
+            expected[k] = v;
+        }
+    }
+    for( int k = 0; k < key_range; ++k ) {
+        const char cached = cache.get( point( k, k ), -1 );
+        CAPTURE( k );
+        // Evicted entries are forgotten, but present ones must hold the last value
+        CHECK( ( cached == -1 || cached == expected[k] ) );
+    }
+}
+
+// The shape of map::sees: a few hundred observers and targets close to each
+// other, the same pairs asked about again and again within a turn, and the whole
+// cache dropped whenever the seen cache gets rebuilt.
+template<typename Cache>
+static long long sees_workload( Cache &cache )
+{
+    constexpr int limit = 100000;
+    constexpr int map_side = 132;
+    // Both caches replay the same creatures and moves
+    rng_set_engine_seed( 1234 );
+    std::vector<int> creatures;
+    for( int i = 0; i < 300; ++i ) {
+        creatures.push_back( rng( 0, map_side * map_side - 1 ) );
+    }
+    long long hits = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( int turn = 0; turn < 50; ++turn ) {
+        for( int &c : creatures ) {
+            c += rng( -1, 1 ) * map_side + rng( -1, 1 );
+            c = std::clamp( c, 0, map_side * map_side - 1 );
+        }
+        for( int pass = 0; pass < 4; ++pass ) {
+            for( const int from : creatures ) {
+                for( const int to : creatures ) {
+                    const point key( std::min( from, to ), std::max( from, to ) );
+                    const char cached = cache.get( key, -1 );
+                    if( cached != -1 ) {
+                        hits++;
+                    } else {
+                        cache.insert( limit, key, ( from + to ) % 2 );
+                    }
+                }
+            }
+        }
+        if( turn % 5 == 0 ) {
+            cache.clear();
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    printf( "%lld hits, %lld microseconds\n", hits,
+            static_cast<long long>( std::chrono::duration_cast<std::chrono::microseconds>
+                                    ( end - start ).count() ) );
+    return hits;
+}
+
+TEST_CASE( "lru_cache_sees_benchmark", "[.][lru_cache][benchmark]" )
+{
+    printf( "lru_cache:      " );
+    lru_cache<point, char> list_cache;
+    const long long list_hits = sees_workload( list_cache );
+    printf( "flat_lru_cache: " );
+    flat_lru_cache<point, char> flat_cache;
+    const long long flat_hits = sees_workload( flat_cache );
+    // The flat cache may evict a little differently, but the work has to be comparable
+    CHECK( flat_hits == Approx( list_hits ).epsilon( 0.01 ) );
+}
@@ -5,6 +5,9 @@
 
 #include "cata_catch.h"
 #include "coordinates.h"
+#include "flexbuffer_json.h"
+#include "json.h"
+#include "json_loader.h"
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
@@ -122,7 +125,68 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     CHECK( mt.get_dec_rotation() == 0 );
 }
 
-// TODO: map memory save / load
+TEST_CASE( "map_memory_region_round_trip", "[map_memory]" )
+{
+    mm_region region;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            region.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    memorized_tile a;
+    a.symbol = 'a';
+    a.set_ter_id( "t_foo" );
+    a.set_ter_subtile( 2 );
+    memorized_tile b = a;
+    b.set_dec_id( "f_bar" );
+    b.set_dec_rotation( 3 );
+    memorized_tile c;
+    c.set_ter_id( "t_baz" );
+    c.set_dec_id( "t_foo" );
+    region.submaps[0][0]->set_tile( point_sm_ms( 0, 0 ), a );
+    region.submaps[0][0]->set_tile( point_sm_ms( 1, 0 ), a );
+    region.submaps[0][0]->set_tile( point_sm_ms( 2, 0 ), b );
+    region.submaps[3][5]->set_tile( point_sm_ms( 4, 7 ), c );
+    region.submaps[3][5]->set_tile( point_sm_ms( 5, 7 ), b );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    region.serialize( jsout );
+
+    mm_region loaded;
+    loaded.deserialize( json_loader::from_string( os.str() ) );
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            CAPTURE( x, y );
+            CHECK( loaded.submaps[x][y]->is_empty() == region.submaps[x][y]->is_empty() );
+        }
+    }
+    CHECK( loaded.submaps[0][0]->get_tile( point_sm_ms( 0, 0 ) ) == a );
+    CHECK( loaded.submaps[0][0]->get_tile( point_sm_ms( 1, 0 ) ) == a );
+    CHECK( loaded.submaps[0][0]->get_tile( point_sm_ms( 2, 0 ) ) == b );
+    CHECK( loaded.submaps[0][0]->get_tile( point_sm_ms( 3, 0 ) ) == mm_submap::default_tile );
+    CHECK( loaded.submaps[3][5]->get_tile( point_sm_ms( 4, 7 ) ) == c );
+    CHECK( loaded.submaps[3][5]->get_tile( point_sm_ms( 5, 7 ) ) == b );
+    CHECK( loaded.submaps[3][5]->get_tile( point_sm_ms( 5, 7 ) ).get_dec_id() == "f_bar" );
+}
+
+TEST_CASE( "map_memory_loads_region_version_1", "[map_memory]" )
+{
+    std::string json = R"({"version":1,"data":[[[1,97,"t_foo",2,0,"f_bar",0,3],[143,0,"",0,0]])";
+    for( int i = 1; i < MM_REG_SIZE * MM_REG_SIZE; i++ ) {
+        json += ",null";
+    }
+    json += "]}";
+    mm_region loaded;
+    loaded.deserialize( json_loader::from_string( json ) );
+    const memorized_tile &mt = loaded.submaps[0][0]->get_tile( point_sm_ms( 0, 0 ) );
+    CHECK( mt.symbol == 'a' );
+    CHECK( mt.get_ter_id() == "t_foo" );
+    CHECK( mt.get_ter_subtile() == 2 );
+    CHECK( mt.get_dec_id() == "f_bar" );
+    CHECK( mt.get_dec_rotation() == 3 );
+    CHECK( loaded.submaps[0][0]->get_tile( point_sm_ms( 1, 0 ) ) == mm_submap::default_tile );
+}
 
 #include <chrono>
 
@@ -647,3 +647,131 @@ TEST_CASE( "map_route_mon_around_danger", "[map][pathfinding]" )
     }
     clear_map();
 }
+
+TEST_CASE( "map_route_reuses_cached_route_until_terrain_changes", "[map][pathfinding]" )
+{
+    map &m = setup_map_without_obstacles();
+    const Character &pc = place_player_at( tripoint_bub_ms{ 65, 65, 0 } );
+    const pathfinding_settings settings = pc.get_pathfinding_settings();
+    /*
+     * Map layout:
+     *   . . . . . . .     1=source
+     *   . 1 # # # 2 .     2=target
+     *   . . . . . . .     #=obstacle
+     */
+    place_obstacle( m, { { 6, 5, 0 }, { 7, 5, 0 }, { 8, 5, 0 } } );
+    const tripoint_bub_ms source{ 5, 5, 0 };
+    const pathfinding_target t = pathfinding_target::point( tripoint_bub_ms{ 9, 5, 0 } );
+    const std::vector<tripoint_bub_ms> path = m.route( source, t, settings );
+    REQUIRE( path.size() == 4 );
+    REQUIRE( path.back() == t.center );
+
+    WHEN( "another creature paths to the same target from a tile on that route" ) {
+        const std::vector<tripoint_bub_ms> rest = m.route( path[0], t, settings );
+        THEN( "it gets the remainder of the route" ) {
+            CHECK( rest == std::vector<tripoint_bub_ms>( path.begin() + 1, path.end() ) );
+        }
+    }
+    WHEN( "the route is blocked by something the cache doesn't know about" ) {
+        const tripoint_bub_ms blocked = path[1];
+        const std::vector<tripoint_bub_ms> rest = m.route( path[0], t, settings,
+        [&blocked]( const tripoint_bub_ms & p ) {
+            return p == blocked;
+        } );
+        THEN( "a new route around it is found" ) {
+            REQUIRE( !rest.empty() );
+            CHECK( rest.back() == t.center );
+            CHECK( std::find( rest.begin(), rest.end(), blocked ) == rest.end() );
+        }
+    }
+    WHEN( "the terrain on the route changes" ) {
+        place_obstacle( m, { path[1] } );
+        const std::vector<tripoint_bub_ms> new_path = m.route( source, t, settings );
+        THEN( "the route is recalculated around it" ) {
+            REQUIRE( !new_path.empty() );
+            CHECK( new_path.back() == t.center );
+            CHECK( std::find( new_path.begin(), new_path.end(), path[1] ) == new_path.end() );
+        }
+    }
+    clear_map();
+}
+
+TEST_CASE( "map_route_cache_notices_door_turning_into_wall", "[map][pathfinding]" )
+{
+    map &m = setup_map_without_obstacles();
+    pathfinding_settings settings = place_player_at( tripoint_bub_ms{ 65, 65, 0 } ).get_pathfinding_settings();
+    settings.allow_open_doors = true;
+    settings.bash_strength = 0;
+    /*
+     * Map layout:
+     *   . . . # # #     1=source
+     *   . 1 . + 2 #     2=target
+     *   . . . # # #     +=closed door, #=obstacle
+     */
+    place_obstacle( m, { { 8, 4, 0 }, { 9, 4, 0 }, { 10, 4, 0 }, { 10, 5, 0 }, { 8, 6, 0 }, { 9, 6, 0 }, { 10, 6, 0 } } );
+    const tripoint_bub_ms door{ 8, 5, 0 };
+    REQUIRE( m.ter_set( door, ter_id( "t_door_c" ) ) );
+    clear_map_caches( m );
+    const tripoint_bub_ms source{ 6, 5, 0 };
+    const pathfinding_target t = pathfinding_target::point( tripoint_bub_ms{ 9, 5, 0 } );
+    const std::vector<tripoint_bub_ms> path = m.route( source, t, settings );
+    REQUIRE( !path.empty() );
+    REQUIRE( std::find( path.begin(), path.end(), door ) != path.end() );
+
+    // Both are obstacles to the pathfinding flags, only the cost of passing differs
+    REQUIRE( m.ter_set( door, ter_id( "t_wall_metal" ) ) );
+    CHECK( m.route( source, t, settings ).empty() );
+    clear_map();
+}
+
+// Cost of walking a path on flat floor, as the pathfinder sees it
+static int flat_path_cost( const tripoint_bub_ms &from, const std::vector<tripoint_bub_ms> &path )
+{
+    int cost = 0;
+    tripoint_bub_ms cur = from;
+    for( const tripoint_bub_ms &p : path ) {
+        REQUIRE( square_dist( cur, p ) == 1 );
+        cost += 2 + ( ( cur.x() != p.x() && cur.y() != p.y() ) ? 1 : 0 );
+        cur = p;
+    }
+    return cost;
+}
+
+TEST_CASE( "map_route_many_creatures_to_same_target", "[map][pathfinding]" )
+{
+    map &m = setup_map_without_obstacles();
+    const Character &pc = place_player_at( tripoint_bub_ms{ 65, 65, 0 } );
+    const pathfinding_settings settings = pc.get_pathfinding_settings();
+    /*
+     * Map layout:
+     *   . . . # . . .     s=sources
+     *   s s . # . T .     T=target
+     *   s s . # . . .     #=obstacle
+     *   . . . . . . .
+     */
+    std::vector<tripoint_bub_ms> wall;
+    for( int y = 2; y <= 12; ++y ) {
+        wall.emplace_back( 10, y, 0 );
+    }
+    place_obstacle( m, wall );
+    const pathfinding_target t = pathfinding_target::point( tripoint_bub_ms{ 14, 6, 0 } );
+    const std::vector<tripoint_bub_ms> sources = {
+        { 6, 6, 0 }, { 5, 7, 0 }, { 6, 7, 0 }, { 5, 6, 0 }, { 4, 9, 0 }
+    };
+    int unique_settings = 1;
+    for( const tripoint_bub_ms &source : sources ) {
+        CAPTURE( source );
+        const std::vector<tripoint_bub_ms> path = m.route( source, t, settings );
+        REQUIRE( !path.empty() );
+        CHECK( path.back() == t.center );
+        for( const tripoint_bub_ms &p : wall ) {
+            CHECK( std::find( path.begin(), path.end(), p ) == path.end() );
+        }
+        // Unique settings so that this one is always a fresh search
+        pathfinding_settings search_settings = settings;
+        search_settings.max_length += unique_settings++;
+        const std::vector<tripoint_bub_ms> searched = m.route( source, t, search_settings );
+        CHECK( flat_path_cost( source, path ) == flat_path_cost( source, searched ) );
+    }
+    clear_map();
+}
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+#include "cata_catch.h"
+#include "cata_path.h"
+#include "coordinates.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_scale_constants.h"
+#include "mapbuffer.h"
+#include "path_info.h"
+#include "point.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "type_id.h"
+
+static const ter_str_id ter_t_floor_waxed( "t_floor_waxed" );
+
+// A quad far enough from the reality bubble that saving writes it out and unloads it
+static tripoint_abs_omt quad_outside_bubble()
+{
+    return project_to<coords::omt>( get_map().get_abs_sub() ) + point( 2 * MAPSIZE, 0 );
+}
+
+// Generates the quad, marks one of its tiles and writes it to disk
+static void save_marked_quad( const tripoint_abs_omt &quad, const point_sm_ms &mark )
+{
+    submap *sm = MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) );
+    if( sm == nullptr ) {
+        tinymap tm;
+        tm.load( quad, false );
+        sm = MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) );
+    }
+    REQUIRE( sm != nullptr );
+    sm->set_ter( mark, ter_t_floor_waxed.id() );
+    MAPBUFFER.save();
+}
+
+static std::filesystem::path quad_file( const tripoint_abs_omt &quad )
+{
+    const tripoint_abs_seg segment = project_to<coords::seg>( quad );
+    const cata_path path = PATH_INFO::world_base_save_path() / "maps" /
+                           string_format( "%d.%d.%d", segment.x(), segment.y(), segment.z() ) /
+                           string_format( "%d.%d.%d.map", quad.x(), quad.y(), quad.z() );
+    return path.get_unrelative_path();
+}
+
+static ter_id marked_ter( const tripoint_abs_omt &quad, const point_sm_ms &mark )
+{
+    submap *sm = MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) );
+    REQUIRE( sm != nullptr );
+    return sm->get_ter( mark );
+}
+
+TEST_CASE( "mapbuffer_prefetched_quad_matches_file", "[mapbuffer]" )
+{
+    clear_map();
+    const tripoint_abs_omt quad = quad_outside_bubble();
+    const point_sm_ms mark( 3, 4 );
+    save_marked_quad( quad, mark );
+
+    MAPBUFFER.prefetch( { quad } );
+    CHECK( marked_ter( quad, mark ) == ter_t_floor_waxed.id() );
+    MAPBUFFER.clear_outside_reality_bubble();
+}
+
+TEST_CASE( "mapbuffer_prefetched_quads_survive_saving_others", "[mapbuffer]" )
+{
+    clear_map();
+    const tripoint_abs_omt quad = quad_outside_bubble();
+    const tripoint_abs_omt other = quad + point::south;
+    const point_sm_ms mark( 3, 4 );
+    save_marked_quad( quad, mark );
+
+    MAPBUFFER.prefetch( { quad } );
+    // Saving has to wait only for reads of the quads it writes
+    save_marked_quad( other, mark );
+    CHECK( marked_ter( quad, mark ) == ter_t_floor_waxed.id() );
+    CHECK( marked_ter( other, mark ) == ter_t_floor_waxed.id() );
+    MAPBUFFER.clear_outside_reality_bubble();
+}
+
+TEST_CASE( "mapbuffer_save_skips_unchanged_quads", "[mapbuffer]" )
+{
+    clear_map();
+    const bool in_bubble = GENERATE( false, true );
+    CAPTURE( in_bubble );
+    const tripoint_abs_omt quad = in_bubble ?
+                                  project_to<coords::omt>( get_map().get_abs_sub() ) + point::south_east :
+                                  quad_outside_bubble();
+    save_marked_quad( quad, point_sm_ms( 3, 4 ) );
+    const std::filesystem::path path = quad_file( quad );
+    REQUIRE( std::filesystem::exists( path ) );
+    const std::filesystem::file_time_type long_ago =
+        std::filesystem::last_write_time( path ) - std::chrono::hours( 1 );
+    std::filesystem::last_write_time( path, long_ago );
+
+    // Handed out again, which is enough to have it serialized, but not changed
+    REQUIRE( MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) ) != nullptr );
+    MAPBUFFER.save();
+    CHECK( std::filesystem::last_write_time( path ) == long_ago );
+
+    save_marked_quad( quad, point_sm_ms( 5, 6 ) );
+    CHECK( std::filesystem::last_write_time( path ) != long_ago );
+    clear_map();
+    MAPBUFFER.clear_outside_reality_bubble();
+}
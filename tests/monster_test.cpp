@@ -725,3 +725,50 @@ TEST_CASE( "monsters_spawn_baby_groups", "[monster][reproduction]" )
     CAPTURE( amount_of_iteration );
     CHECK( test_monster_spawns_baby_mongroup );
 }
+
+TEST_CASE( "creature_tracker_range_query_follows_monsters", "[monster][creature_tracker]" )
+{
+    clear_map();
+    map &here = get_map();
+    creature_tracker &creatures = get_creature_tracker();
+    const tripoint_bub_ms center( 60, 60, 0 );
+    monster &near = spawn_test_monster( "mon_zombie", center + tripoint( 2, -3, 0 ) );
+    monster &far = spawn_test_monster( "mon_zombie", center + tripoint( 20, 0, 0 ) );
+
+    const auto in_range = [&]( int radius ) {
+        std::vector<const monster *> found;
+        creatures.for_each_monster_in_range( here.get_abs( center ), radius,
+        [&]( monster & critter ) {
+            found.push_back( &critter );
+        } );
+        return found;
+    };
+
+    CHECK( in_range( 3 ) == std::vector<const monster *> { &near } );
+    CHECK( in_range( 2 ).empty() );
+    CHECK( in_range( 20 ).size() == 2 );
+    CHECK( in_range( -1 ).size() == 2 );
+
+    // Crossing into another submap moves it to another bucket
+    far.setpos( here, center + tripoint( 1, 1, 0 ) );
+    CHECK( in_range( 1 ) == std::vector<const monster *> { &far } );
+    near.setpos( here, center + tripoint( 30, 30, 0 ) );
+    CHECK( in_range( 3 ) == std::vector<const monster *> { &far } );
+
+    SECTION( "faction filter" ) {
+        const mfaction_id zombie_faction = near.faction;
+        int matched = 0;
+        creatures.for_each_monster_in_range( here.get_abs( center ), -1,
+        [&]( const mfaction_id & fac ) {
+            return fac != zombie_faction;
+        }, [&]( monster & ) {
+            ++matched;
+        } );
+        CHECK( matched == 0 );
+    }
+
+    SECTION( "dead monsters are skipped" ) {
+        far.die( &here, nullptr );
+        CHECK( in_range( 3 ).empty() );
+    }
+}
@@ -16,6 +16,7 @@
 
 #include "calendar.h"
 #include "cata_catch.h"
+#include "character.h"
 #include "city.h"
 #include "common_types.h"
 #include "coordinates.h"
@@ -30,6 +31,7 @@
 #include "map_iterator.h"
 #include "map_scale_constants.h"
 #include "mapbuffer.h"
+#include "mongroup.h"
 #include "omdata.h"
 #include "output.h"
 #include "overmap.h"
@@ -151,6 +153,61 @@ TEST_CASE( "default_overmap_generation_has_non_mandatory_specials_at_origin", "[
     CHECK( found_optional == true );
 }
 
+TEST_CASE( "overmap_neighbor_created_ahead_near_edge", "[overmap][slow]" )
+{
+    overmap_buffer.clear();
+    const point_abs_om om( 50, 50 );
+    const tripoint_abs_omt om_corner = project_combine( om, tripoint_om_omt::zero );
+    const tripoint_abs_omt middle = om_corner + tripoint( OMAPX / 2, OMAPY / 2, 0 );
+    const tripoint_abs_omt near_east_edge = om_corner + tripoint( OMAPX - 3, OMAPY / 2, 0 );
+
+    CHECK_FALSE( overmap_buffer.create_neighbor_ahead( middle, 10 ) );
+    CHECK_FALSE( overmap_buffer.create_neighbor_ahead( near_east_edge, 2 ) );
+    REQUIRE_FALSE( overmap_buffer.has( om + point::east ) );
+
+    CHECK( overmap_buffer.create_neighbor_ahead( near_east_edge, 10 ) );
+    CHECK( overmap_buffer.has( om + point::east ) );
+    // Only the one across the edge is needed, and it exists now
+    CHECK_FALSE( overmap_buffer.create_neighbor_ahead( near_east_edge, 10 ) );
+}
+
+TEST_CASE( "hordes_walk_onto_neighbouring_overmaps", "[overmap][slow]" )
+{
+    overmap_buffer.clear();
+    // Hordes only move on the overmaps around the player
+    const point_abs_om om = project_to<coords::om>( get_player_character().pos_abs_sm().xy() );
+    const std::vector<const overmap_special *> no_specials;
+    overmap_special_batch om_specials( om, no_specials );
+    overmap_buffer.create_custom_overmap( om, om_specials );
+    const tripoint_abs_sm east_edge = project_combine( om, tripoint_om_sm( 2 * OMAPX - 1, OMAPY, 0 ) );
+    const tripoint_abs_sm across = east_edge + point::east;
+    mongroup horde( "GROUP_ZOMBIE", east_edge, 10, across.xy() + point( 5, 0 ), 100, false, true );
+    horde.behaviour = mongroup::horde_behaviour::roam;
+    overmap_buffer.get( om ).debug_force_add_group( horde );
+
+    const auto move_hordes = [&]() {
+        // Whether a horde moves is random, but it doesn't take long to do so
+        for( int i = 0; i < 50 && overmap_buffer.groups_at( across ).empty(); ++i ) {
+            overmap_buffer.move_hordes();
+        }
+    };
+
+    SECTION( "waits at the border while the neighbour is not loaded" ) {
+        REQUIRE_FALSE( overmap_buffer.has( om + point::east ) );
+        move_hordes();
+        CHECK( overmap_buffer.groups_at( east_edge ).size() == 1 );
+        CHECK( overmap_buffer.groups_at( across ).empty() );
+    }
+
+    SECTION( "crosses into a loaded neighbour" ) {
+        overmap_special_batch east_specials( om + point::east, no_specials );
+        overmap_buffer.create_custom_overmap( om + point::east, east_specials );
+        move_hordes();
+        CHECK( overmap_buffer.groups_at( east_edge ).empty() );
+        CHECK( overmap_buffer.groups_at( across ).size() == 1 );
+    }
+}
+
 TEST_CASE( "is_ot_match", "[overmap][terrain]" )
 {
     SECTION( "exact match" ) {
@@ -0,0 +1,66 @@
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "point.h"
+#include "scent_map.h"
+#include "type_id.h"
+
+static const ter_str_id ter_t_wall( "t_wall" );
+
+TEST_CASE( "scent_spreads_one_tile_per_update", "[scent]" )
+{
+    clear_map();
+    map &here = get_map();
+    scent_map &scent = get_scent();
+    scent.reset();
+
+    const tripoint_bub_ms source( 60, 60, 0 );
+    scent.set( source, 1000 );
+    for( int i = 0; i < 4; ++i ) {
+        scent.update( source, here );
+    }
+
+    CHECK( scent.get( source ) > 0 );
+    const int east = scent.get( source + point::east );
+    CHECK( east > 0 );
+    CHECK( scent.get( source + point::west ) == east );
+    CHECK( scent.get( source + point::north ) == east );
+    CHECK( scent.get( source + point::south ) == east );
+    CHECK( scent.get( source + point( 5, 0 ) ) == 0 );
+    CHECK( scent.get( source + point( 0, -5 ) ) == 0 );
+
+    // Everything is gone once the strongest scent had time to decay
+    for( int i = 0; i < 1000; ++i ) {
+        scent.decay();
+    }
+    for( const tripoint_bub_ms &p : here.points_in_radius( source, 6 ) ) {
+        CAPTURE( p );
+        CHECK( scent.get( p ) == 0 );
+    }
+    scent.reset();
+}
+
+TEST_CASE( "scent_does_not_pass_new_walls", "[scent]" )
+{
+    clear_map();
+    map &here = get_map();
+    scent_map &scent = get_scent();
+    scent.reset();
+    REQUIRE( ter_t_wall->has_flag( ter_furn_flag::TFLAG_NO_SCENT ) );
+
+    const tripoint_bub_ms source( 60, 60, 0 );
+    scent.set( source, 1000 );
+    scent.update( source, here );
+    REQUIRE( scent.get( source + point::east ) > 0 );
+
+    // The flags from the previous update are cached, building the wall has to invalidate them
+    here.ter_set( source + point::east, ter_t_wall );
+    scent.update( source, here );
+    CHECK( scent.get( source + point::east ) == 0 );
+    scent.update( source, here );
+    CHECK( scent.get( source + point::east ) == 0 );
+    CHECK( scent.get( source + point::west ) > 0 );
+    scent.reset();
+}
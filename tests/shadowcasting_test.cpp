@@ -9,7 +9,9 @@
 #include <string>
 #include <vector>
 
+#include "cached_options.h"
 #include "cata_catch.h"
+#include "cata_scope_helpers.h"
 #include "coordinates.h"
 #include "cuboid_rectangle.h"
 #include "level_cache.h"
@@ -1125,6 +1127,53 @@ TEST_CASE( "shadowcasting_3d_performance", "[.]" )
     shadowcasting_3d_benchmark( 10000 );
 }
 
+TEST_CASE( "shadowcasting_3d_threaded_equivalence", "[shadowcasting]" )
+{
+    struct test_grids {
+        std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> transparency_cache = {};
+        std::array<cata::mdarray<bool, point_bub_ms>, OVERMAP_LAYERS> floor_cache = {};
+        std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> serial = {};
+        std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> threaded = {};
+    };
+    std::unique_ptr<test_grids> grids = std::make_unique<test_grids>();
+
+    array_of_grids_of<const float> transparency_caches;
+    array_of_grids_of<const bool> floor_caches;
+    array_of_grids_of<float> serial_caches;
+    array_of_grids_of<float> threaded_caches;
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        randomly_fill_transparency( grids->transparency_cache[z] );
+        grids->floor_cache[z].fill_from_callable( []() {
+            return one_in( 4 );
+        } );
+        transparency_caches[z] = &grids->transparency_cache[z];
+        floor_caches[z] = &grids->floor_cache[z];
+        serial_caches[z] = &grids->serial[z];
+        threaded_caches[z] = &grids->threaded[z];
+    }
+
+    const tripoint_bub_ms origin( 65, 65, 0 );
+    restore_on_out_of_scope restore_threaded( threaded_shadowcasting );
+    threaded_shadowcasting = false;
+    cast_zlight<float, sight_calc, sight_check, accumulate_transparency>(
+        serial_caches, transparency_caches, floor_caches, origin, 0, 1.0 );
+    threaded_shadowcasting = true;
+    cast_zlight<float, sight_calc, sight_check, accumulate_transparency>(
+        threaded_caches, transparency_caches, floor_caches, origin, 0, 1.0 );
+
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        CAPTURE( z );
+        for( int x = 0; x < MAPSIZE_X; ++x ) {
+            for( int y = 0; y < MAPSIZE_Y; ++y ) {
+                if( grids->serial[z][x][y] != grids->threaded[z][x][y] ) {
+                    CAPTURE( x, y );
+                    REQUIRE( grids->serial[z][x][y] == grids->threaded[z][x][y] );
+                }
+            }
+        }
+    }
+}
+
 TEST_CASE( "shadowcasting_float_quad_equivalence", "[shadowcasting]" )
 {
     shadowcasting_float_quad( 1 );
@@ -0,0 +1,61 @@
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "options_helpers.h"
+#include "point.h"
+#include "sounds.h"
+#include "type_id.h"
+#include "weather_type.h"
+
+static const ter_str_id ter_t_wall( "t_wall" );
+
+TEST_CASE( "sound_goes_around_and_through_walls", "[sounds]" )
+{
+    clear_map( -2, 1 );
+    scoped_weather_override weather_clear( WEATHER_CLEAR );
+    // Leftover sounds from other tests would be heard as well
+    sounds::reset_sounds();
+    map &here = get_map();
+    for( int y = 30; y <= 90; ++y ) {
+        here.ter_set( tripoint_bub_ms( 60, y, 0 ), ter_t_wall );
+    }
+    // Zombies wander off for as long as the sound was loud when it got to them
+    monster &in_the_open = spawn_test_monster( "mon_zombie", tripoint_bub_ms( 40, 60, 0 ) );
+    monster &behind_wall = spawn_test_monster( "mon_zombie", tripoint_bub_ms( 70, 60, 0 ) );
+    monster &past_wall = spawn_test_monster( "mon_zombie", tripoint_bub_ms( 61, 95, 0 ) );
+    monster &too_far = spawn_test_monster( "mon_zombie", tripoint_bub_ms( 50, 125, 0 ) );
+    sounds::sound( tripoint_bub_ms( 50, 60, 0 ), 60, sounds::sound_t::combat, "bang" );
+    sounds::process_sounds();
+
+    CHECK( in_the_open.wandf == 60 - 10 );
+    // Straight through the wall is 20 tiles, the wall adds 9 to that
+    CHECK( behind_wall.wandf == 60 - 29 );
+    // Past the end of the wall it's open air all the way
+    CHECK( past_wall.wandf == 60 - 35 );
+    CHECK( too_far.wandf == 0 );
+}
+
+TEST_CASE( "sound_propagation_benchmark", "[.][sounds][benchmark]" )
+{
+    clear_map( -2, 1 );
+    scoped_weather_override weather_clear( WEATHER_CLEAR );
+    sounds::reset_sounds();
+    map &here = get_map();
+    // A wall with doorways, and a crowd on both sides of it
+    for( int y = 10; y < 120; ++y ) {
+        if( y % 20 != 0 ) {
+            here.ter_set( tripoint_bub_ms( 60, y, 0 ), ter_t_wall );
+        }
+    }
+    for( int i = 0; i < 50; ++i ) {
+        spawn_test_monster( "mon_zombie", tripoint_bub_ms( 30 + i % 10 * 7, 20 + i / 10 * 20, 0 ) );
+    }
+
+    BENCHMARK( "process_sounds" ) {
+        sounds::sound( tripoint_bub_ms( 40, 50, 0 ), 40, sounds::sound_t::combat, "bang" );
+        sounds::sound( tripoint_bub_ms( 80, 70, 0 ), 80, sounds::sound_t::combat, "boom" );
+        sounds::process_sounds();
+    };
+}
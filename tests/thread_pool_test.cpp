@@ -0,0 +1,54 @@
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "cata_catch.h"
+#include "thread_pool.h"
+
+TEST_CASE( "thread_pool_runs_every_parallel_task_once", "[thread_pool]" )
+{
+    const size_t workers = GENERATE( 0, 1, 3 );
+    CAPTURE( workers );
+    thread_pool pool( workers );
+    REQUIRE( pool.num_workers() == workers );
+
+    std::vector<std::atomic<int>> runs( 100 );
+    pool.run_parallel( runs.size(), [&runs]( size_t i ) {
+        ++runs[i];
+    } );
+    for( const std::atomic<int> &run : runs ) {
+        CHECK( run == 1 );
+    }
+}
+
+TEST_CASE( "thread_pool_submitted_jobs_complete", "[thread_pool]" )
+{
+    thread_pool pool( 2 );
+    std::atomic<int> sum{ 0 };
+    std::vector<std::future<void>> results;
+    for( int i = 1; i <= 10; ++i ) {
+        results.emplace_back( pool.submit( [&sum, i]() {
+            sum += i;
+        } ) );
+    }
+    for( std::future<void> &result : results ) {
+        result.get();
+    }
+    CHECK( sum == 55 );
+}
+
+TEST_CASE( "thread_pool_rethrows_task_exceptions", "[thread_pool]" )
+{
+    thread_pool pool( 2 );
+    CHECK_THROWS_AS( pool.run_parallel( 8, []( size_t i ) {
+        if( i == 5 ) {
+            throw std::runtime_error( "task failed" );
+        }
+    } ), std::runtime_error );
+    std::future<void> result = pool.submit( []() {
+        throw std::runtime_error( "job failed" );
+    } );
+    CHECK_THROWS_AS( result.get(), std::runtime_error );
+}
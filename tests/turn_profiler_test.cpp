@@ -0,0 +1,68 @@
+#include <sstream>
+#include <string>
+
+#include "cata_catch.h"
+#include "json.h"
+#include "json_loader.h"
+#include "perf.h"
+
+TEST_CASE( "turn_profiler_records_nested_phases", "[turn_profiler]" )
+{
+    turn_profiler &profiler = turn_profiler::get();
+    profiler.clear();
+
+    SECTION( "nothing is recorded while disabled" ) {
+        profiler.set_enabled( false );
+        {
+            turn_profile_turn turn( 1 );
+            turn_profile_scope phase( "monmove" );
+        }
+        CHECK( profiler.num_recorded_turns() == 0 );
+    }
+
+    SECTION( "phases nest inside the turn" ) {
+        profiler.set_enabled( true );
+        {
+            turn_profile_turn turn( 7 );
+            turn_profile_scope outer( "vision" );
+            {
+                turn_profile_scope inner( "lightmap" );
+            }
+        }
+        profiler.set_enabled( false );
+        REQUIRE( profiler.num_recorded_turns() == 1 );
+        const turn_profiler::turn_record &record = profiler.recorded_turn( 0 );
+        CHECK( record.turn == 7 );
+        REQUIRE( record.events.size() == 2 );
+        CHECK( std::string( record.events[0].name ) == "vision" );
+        CHECK( record.events[0].depth == 0 );
+        CHECK( std::string( record.events[1].name ) == "lightmap" );
+        CHECK( record.events[1].depth == 1 );
+        CHECK( record.events[1].start_us >= record.events[0].start_us );
+        CHECK( record.events[0].duration_us <= record.duration_us );
+
+        CHECK( profiler.summary().find( "lightmap" ) != std::string::npos );
+
+        std::ostringstream trace;
+        profiler.write_chrome_trace( trace );
+        JsonValue jv = json_loader::from_string( trace.str() );
+        JsonObject jo = jv.get_object();
+        jo.allow_omitted_members();
+        // The turn itself and its two phases
+        CHECK( jo.get_array( "traceEvents" ).size() == 3 );
+    }
+
+    SECTION( "only the last turns are kept" ) {
+        profiler.set_enabled( true );
+        for( size_t i = 0; i < turn_profiler::max_turns + 5; ++i ) {
+            turn_profile_turn turn( static_cast<int>( i ) );
+        }
+        profiler.set_enabled( false );
+        REQUIRE( profiler.num_recorded_turns() == turn_profiler::max_turns );
+        CHECK( profiler.recorded_turn( 0 ).turn == 5 );
+        CHECK( profiler.recorded_turn( turn_profiler::max_turns - 1 ).turn ==
+               static_cast<int>( turn_profiler::max_turns + 4 ) );
+    }
+
+    profiler.clear();
+}
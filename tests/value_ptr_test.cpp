@@ -1,4 +1,8 @@
+#include <map>
+#include <set>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "cata_catch.h"
 #include "value_ptr.h"
@@ -45,3 +49,54 @@ TEST_CASE( "value_ptr_move_assignment", "[value_ptr]" )
     CHECK( !a ); // NOLINT(bugprone-use-after-move)
     CHECK( !!b );
 }
+
+TEST_CASE( "heap_reads_default_until_written", "[value_ptr][nogame]" )
+{
+    cata::heap<std::set<int>> empty;
+    const cata::heap<std::set<int>> &const_empty = empty;
+    CHECK( const_empty.empty() );
+    CHECK( const_empty.count( 1 ) == 0 );
+    CHECK( const_empty.begin() == const_empty.end() );
+
+    cata::heap<std::set<int>> copy( empty );
+    CHECK( copy == empty );
+    copy.insert( 1 );
+    CHECK( copy.count( 1 ) == 1 );
+    CHECK( empty.empty() );
+    CHECK( copy != empty );
+
+    copy.clear();
+    CHECK( copy.empty() );
+    CHECK( copy == empty );
+}
+
+TEST_CASE( "heap_copies_and_moves_values", "[value_ptr][nogame]" )
+{
+    cata::heap<std::map<std::string, int>> values;
+    values["a"] = 1;
+    cata::heap<std::map<std::string, int>> copy;
+    copy = values;
+    values["a"] = 2;
+    CHECK( copy.find( "a" )->second == 1 );
+
+    cata::heap<std::map<std::string, int>> moved( std::move( copy ) );
+    CHECK( moved.size() == 1 );
+    // Moved-from heaps read as empty and can be written again
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    CHECK( copy.empty() );
+    copy["b"] = 3;
+    CHECK( copy.size() == 1 );
+}
+
+TEST_CASE( "heap_copy_benchmark", "[.][value_ptr][benchmark][nogame]" )
+{
+    // Copying a heap that was never written to doesn't allocate
+    const cata::heap<std::set<int>> unallocated;
+    const cata::heap<std::set<int>> allocated( std::set<int> {} );
+    BENCHMARK( "unallocated" ) {
+        return std::vector<cata::heap<std::set<int>>>( 100, unallocated );
+    };
+    BENCHMARK( "allocated" ) {
+        return std::vector<cata::heap<std::set<int>>>( 100, allocated );
+    };
+}
@@ -33,6 +33,7 @@
 
 static const efftype_id effect_narcosis( "narcosis" );
 
+static const field_type_str_id field_fd_clairvoyant( "fd_clairvoyant" );
 static const field_type_str_id field_fd_smoke( "fd_smoke" );
 
 static const move_mode_id move_mode_crouch( "crouch" );
@@ -1186,3 +1187,39 @@ TEST_CASE( "pl_sees-oob-nocrash", "[vision]" )
 
     clear_avatar();
 }
+
+TEST_CASE( "vision_cache_matches_apparent_light", "[vision]" )
+{
+    map &here = get_map();
+    clear_avatar();
+    clear_map();
+    const tripoint_bub_ms center{ 60, 60, 0 };
+    get_avatar().setpos( here, center );
+    // A closed room, so most of the bubble is out of sight and takes the bulk path
+    for( int i = -3; i <= 3; i++ ) {
+        here.ter_set( center + point( i, -3 ), ter_t_brick_wall );
+        here.ter_set( center + point( i, 3 ), ter_t_brick_wall );
+        here.ter_set( center + point( -3, i ), ter_t_brick_wall );
+        here.ter_set( center + point( 3, i ), ter_t_brick_wall );
+    }
+    const tripoint_bub_ms clairvoyant = center + point( 10, 0 );
+    here.add_field( clairvoyant, field_fd_clairvoyant, 1 );
+
+    const time_point when = GENERATE( midnight, day_time );
+    CAPTURE( to_string( when ) );
+    set_time( when );
+    here.invalidate_visibility_cache();
+    here.update_visibility_cache( center.z() );
+
+    const visibility_variables &vvcache = here.get_visibility_variables_cache();
+    const level_cache &cache = here.get_cache_ref( center.z() );
+    CHECK( cache.visibility_cache[clairvoyant.x()][clairvoyant.y()] == lit_level::BRIGHT );
+    std::vector<tripoint_bub_ms> mismatched;
+    for( const tripoint_bub_ms &p : here.points_on_zlevel( center.z() ) ) {
+        if( cache.visibility_cache[p.x()][p.y()] != here.apparent_light_at( p, vvcache ) ) {
+            mismatched.push_back( p );
+        }
+    }
+    CHECK( mismatched.empty() );
+    clear_map();
+}
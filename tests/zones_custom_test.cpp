@@ -71,6 +71,9 @@ TEST_CASE( "zones_custom", "[zones]" )
         REQUIRE( zmgr.get_near_zone_type_for_item( batt, where ) == zone_type_LOOT_ITEM_GROUP );
         // this should match both types but custom zone comes first
         REQUIRE( zmgr.get_near_zone_type_for_item( bag_plastic, where ) == zone_type_LOOT_CUSTOM );
+        // the overlap zone is in range, but only the farther hammer zone takes hammers
+        CHECK( !zmgr.get_near_zone_type_for_item( hammer, where, 4 ).is_valid() );
+        CHECK( zmgr.get_near_zone_type_for_item( hammer, where, 5 ) == zone_type_LOOT_CUSTOM );
 
         pset const hammerpoints =
             zmgr.get_near( zone_type_LOOT_CUSTOM, where, MAX_VIEW_DISTANCE, &hammer );